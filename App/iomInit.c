@@ -38,6 +38,31 @@ static IOMCanRoutingPortTbl_t canRoutingTable[] = {{0x8482004,"apexport_PFD_FROM
                                                    {0x8482405,"apexport_PFD_FROM_A825_B",0},
                                                    {-1       ,""                      ,-1}};
 
+/*
+ * Filter rules of the "Pilot Input" messages from the CPs.
+ * The CPs send unchanged messages with all data bytes == zero when the pilot does not operate them.
+ * Validity and HeartBeat bytes are not used for filtering.
+ */
+static const CanFilterRule_t canFilterRules[] =
+{
+    /* 0x08482004, 0x08482005, 0x08482404, 0x08482405                                  */
+    /*   data[0], data[1], data[3], data[4] == 0, data[2] == BARO Unit Selection 1 or 2 */
+    /*   data[5] == Validity, data[6] == HeartBeat                                     */
+    { 0x200, 5, 0, 3, { {0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 2, 0, 0, 0, 0, 0} } },
+    { 0x240, 5, 0, 3, { {0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 1, 0, 0, 0, 0, 0}, {0, 0, 2, 0, 0, 0, 0, 0} } },
+
+    /* 0x08480004 .. 0x08483005, last two bytes are Validity and HeartBeat */
+    { 0x000, 8, 2, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+    { 0x040, 8, 2, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+    { 0x100, 8, 2, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+    { 0x140, 8, 2, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+    { 0x300, 8, 2, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+
+    /* 0x8482014, 0x8482015, 0x8482414, 0x8482415, no Validity and HeartBeat */
+    { 0x201, 8, 0, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } },
+    { 0x241, 8, 0, 1, { {0, 0, 0, 0, 0, 0, 0, 0} } }
+};
+
 /*
  * Set IOM Config according to DUID
  */   
@@ -84,6 +109,7 @@ Byte_t inMsgBuffer[IOEN_MAX_INPUT_MESSAGE_BUFFER_SIZE];      /* Input Message Bu
 void applicationCreatePorts(int appPeriodMs)
 {
     getIOMConfig();
+    ioen_setCanFilterRules(canFilterRules, sizeof(canFilterRules) / sizeof(canFilterRules[0]));
     ioen_createPorts((IOMConfigHeader_t *)IOMconfig);
 	if (strcmp(APPNAME, "PFDIOM") == 0) 
 	{
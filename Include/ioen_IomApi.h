@@ -44,11 +44,56 @@ typedef struct IomObjectCtrlData_t
     Valid_t         validity;
 } IomObjectCtrlData_t;
 
+/*
+ * Filter rule for the CAN frames of the "Pilot Input" messages of one LRU, given by the application.
+ * A frame is discarded, when the compared bytes are unchanged and equal to one of the idle patterns.
+ */
+typedef struct CanFilterRule_t
+{
+    UInt32_t        idKey;               /* CAN ID bits 4..15, without RCI and FS                           */
+    Byte_t          cmpBytes;            /* Number of leading data bytes compared                           */
+    Byte_t          tailBytes;           /* Number of trailing data bytes not compared (validity, heartbeat) */
+    Byte_t          nofIdle;             /* Number of idle patterns                                         */
+    Byte_t          idle[IOEN_CAN_FILTER_MAX_IDLE][IOEN_CAN_MAX_PAYLOAD];  /* Idle patterns of the compared bytes */
+} CanFilterRule_t;
+
+/* Receive statistics of a CAN bus */
+typedef struct CanBusStatistics_t
+{
+    UInt32_t        queueDepthHwm;       /* Max queued driver messages at the start of a cycle (drain mode) */
+                                         /* or max CAN messages in the ring of the reader                   */
+    UInt32_t        framesHwm;           /* Max CAN messages read in one cycle                              */
+    UInt32_t        budgetStops;         /* Number of cycles the read was stopped by the budget             */
+    UInt32_t        ringFullStops;       /* Number of reader runs stopped by a full ring                    */
+} CanBusStatistics_t;
+
+/* Receive statistics of an A429 port */
+typedef struct A429PortStatistics_t
+{
+    UInt32_t        words;               /* A429 words received                                     */
+    UInt32_t        emptyReads;          /* Reads that returned no word                             */
+    UInt32_t        overflows;           /* Reads that reported a full queue (INVALID_CONFIG)       */
+    UInt32_t        budgetStops;         /* Cycles the reads were stopped by the budget             */
+    UInt32_t        budget;              /* Current single word reads per cycle                     */
+} A429PortStatistics_t;
+
+/* Update rate of an A429 label, times in ns */
+typedef struct A429LabelStatistics_t
+{
+    UInt32_t          updates;           /* Words received                                          */
+    UInt32_t          sameRead;          /* Words received in the same port read as the previous one */
+    SYSTEM_TIME_TYPE  lastArrival;       /* Time of the port read of the last word                  */
+    SYSTEM_TIME_TYPE  minPeriod;         /* Shortest time between two reads with the label          */
+    SYSTEM_TIME_TYPE  maxPeriod;         /* Longest time between two reads with the label           */
+    SYSTEM_TIME_TYPE  meanPeriod;        /* Smoothed time between two reads with the label          */
+    SYSTEM_TIME_TYPE  jitter;            /* Smoothed deviation of the period from meanPeriod        */
+} A429LabelStatistics_t;
+
 /* Control structure to perform the refreshing of data */
 typedef struct IomMessageCtrlData_t
 {
     APEX_INTEGER         apexPortId;     /* Port ID returned by APEX create port function       */
-    UInt32_t             readCycle;      /* Current cycle count before read is required         */
+    UInt32_t             readCycle;      /* Cycle in which the next read is due (queuing ports) */
     UInt16_t             fcCtrl;         /* hold the previous Freshness counter value           */
     UInt16_t             spare;          /* 32 bit alignment                                    */
     IomObjectCtrlData_t  objCtrl;        /* Control structure to perform the refreshing of data */
@@ -76,14 +121,94 @@ void        ioen_readMessagesCan (
                 /*        */ void
             );
 
+void        ioen_setCanDrain (
+               /* IN     */ const Bool_t                 enable,
+               /* IN     */ const UInt32_t               frameBudget,
+               /* IN     */ const UInt32_t               timeBudget
+            );
+
+void        ioen_setCanFilterRules (
+               /* IN     */ const CanFilterRule_t        * const rules_p,
+               /* IN     */ const UInt32_t                       nofRules
+            );
+
+void        ioen_setCanReader (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_runCanReader (
+               /*        */ void
+            );
+
+void        ioen_getCanBusStatistics (
+               /* IN     */ const UInt32_t                       busIdx,
+               /* IN     */ const Bool_t                         clear,
+               /*    OUT */       CanBusStatistics_t     * const stats_p
+            );
+
+Bool_t      ioen_getCanMessageArrival (
+               /* IN     */ const UInt32_t                       canId,
+               /*    OUT */       SYSTEM_TIME_TYPE       * const arrival_p
+            );
+
 void        ioen_readMessagesA429 (
                 /*        */ void
             );
 
+void        ioen_setA429BlockReceive (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_setA429BatchForward (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_setA429ForwardFilter (
+               /* IN     */ const UInt32_t                       portIdx,
+               /* IN     */ const UInt32_t               * const allow_p
+            );
+
+void        ioen_setA429AdaptiveBudget (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_getA429PortStatistics (
+               /* IN     */ const UInt32_t                       portIdx,
+               /* IN     */ const Bool_t                         clear,
+               /*    OUT */       A429PortStatistics_t   * const stats_p
+            );
+
+void        ioen_setA429RateMonitor (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_getA429LabelStatistics (
+               /* IN     */ const UInt32_t                       labelIdx,
+               /* IN     */ const Bool_t                         clear,
+               /*    OUT */       A429LabelStatistics_t  * const stats_p
+            );
+
 void        ioen_processInputAfdxA429 (
                /*        */       void
             );
 
+void        ioen_setIncrementalInput (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_setExecutionPlan (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_setHostOrderInput (
+               /* IN     */ const Bool_t                 enable
+            );
+
+void        ioen_setChangeDrivenSelection (
+               /* IN     */ const Bool_t                 enable,
+               /* IN     */ const UInt32_t               fullSweepInterval
+            );
+
 void        ioen_processOutputAfdx (
                /*        */       void
             );
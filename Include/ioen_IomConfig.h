@@ -26,16 +26,40 @@
 #define IOEN_MAX_SOURCE_SELECTION_INDEX         (128 )         /* Maximum number of different source selection functions        */
 #define IOEN_MAX_SOURCES_PER_INPUT              ( 12)          /* Maximum number of Sources Per Input.                          */
 #define IOEN_MAX_CAN_PARAM_PER_MESSAGE          ( 32)          /* Maximum number of parameters Per CAN Input message.           */
+#define IOEN_MAX_VALIDITY_CONDITIONS            (  4)          /* Maximum number of Validity Check conditions per source.       */
+#define IOEN_MAX_CAN_VALIDITY_CONDITIONS        (  2)          /* Maximum number of Validity Check conditions per CAN mapping.  */
 #define IOEN_MAX_NUMBER_OF_SELECTION_SETS       (1024)         /* Maximum number of Selection sets used for source selection.   */
 #define IOEN_MAX_RX_PORT_NUMBER                 (1024)         /* Maximum number of ports that can be managed by the IO Engine. */
 #define IOEN_MAX_TX_PORT_NUMBER                 (1024)         /* Maximum number of ports that can be managed by the IO Engine. */
-
-#define IOEN_MAX_CAN_MESSAGES_CONFIGURED        (64)           /* Must be checked by config generator tool */
+#define IOEN_AFDX_SCHED_WHEEL_SIZE              (64)           /* Number of slots (cycles) of the AFDX read schedule wheel      */
+#define IOEN_AFDX_SCHED_END                     (0xFFFF)       /* End of a port list in the AFDX read schedule                  */
+#define IOEN_FRESH_WHEEL_SIZE                   (256)          /* Number of slots (cycles) of a message freshness wheel         */
+#define IOEN_FRESH_END                          (0xFFFF)       /* End of a message list in a message freshness wheel            */
+
+#ifdef IOEN_CAN_FD
+#define IOEN_CAN_MAX_PAYLOAD                    (64)           /* Maximum payload of a CAN frame, CAN FD                  */
+#else
+#define IOEN_CAN_MAX_PAYLOAD                    (8)            /* Maximum payload of a CAN frame, classic CAN             */
+#endif
+#define IOEN_CAN_PAYLOAD_WORDS                  (IOEN_CAN_MAX_PAYLOAD / 8)  /* Payload in 64 bit words                  */
+#define IOEN_MAX_CAN_MESSAGES_CONFIGURED        (256)          /* Must be checked by config generator tool */
+#define IOEN_CAN_ID_HASH_SIZE                   (512)          /* Slots of the CAN ID hash table, power of 2 and at least 2 x IOEN_MAX_CAN_MESSAGES_CONFIGURED */
+#define IOEN_CAN_ID_HASH_EMPTY                  (0xFFFF)       /* Empty slot of the CAN ID hash table                  */
+#define IOEN_CAN_ID_HASH_SHIFT                  (23)           /* 32 - log2(IOEN_CAN_ID_HASH_SIZE)                     */
+#define IOEN_CAN_MAX_MAPPINGS                   (2048)         /* Mapping descriptors of all CAN input messages and sources  */
+#define IOEN_CAN_MAP_NONE                       (0xFFFF)       /* Mappings of a CAN message not compiled, walk the configuration */
+#define IOEN_CAN_MAX_RESET_WORDS                (512)          /* INT8_ADD accumulators of all CAN input mappings, per buffer */
+#define IOEN_CAN_FILTER_MAX_IDLE                (3)            /* Maximum number of idle patterns of a CAN frame filter rule */
 #define IOEN_MAX_CAN_MESSAGES_PER_CYCLE         (64)           /* Maximum number of CAN messages that can be received from the APEX driver in one cycle */
+#define IOEN_CAN_TX_WHEEL_SIZE                  (64)           /* Number of slots (cycles) of the CAN transmit schedule wheel */
+#define IOEN_CAN_TX_END                         (0xFFFF)       /* End of a message list in the CAN transmit schedule          */
+#define IOEN_CAN_MAX_DRAIN_READS                (16)           /* Maximum number of reads per CAN bus and cycle in drain mode */
+#define IOEN_CAN_RING_SIZE                      (256)          /* CAN messages per bus in the receive ring of the reader, power of 2 and at least 2 x IOEN_MAX_CAN_MESSAGES_PER_CYCLE */
 
 #define IOEN_CRC32_TABLE_SIZE                   (256)          /* Number of elements in the 32 bit CRC lookup table */
 #define IOEN_CRC32_INIT_VALUE                   (0xFFFFFFFF)   /* Seed value for 32 bit CRC                         */
 #define IOEN_CRC32_FINISH_VALUE                 (0xFFFFFFFF)   /* Finish value for 32 bit CRC                       */
+#define IOEN_CRC32_SLICES                       (8)            /* Number of bytes per step of the slicing CRC       */
 
 #define IOEN_SOURCE_ONE                         (0)
 #define IOEN_SOURCE_LIC_PARAMETER               (1)
@@ -49,11 +73,50 @@
 #define IOEN_CAN_PORT_TYPE_TX_B                 (3)
 #define IOEN_CAN_PORT_TYPE_ROUTING_TX           (4)
 #define IOEN_CAN_PORT_TYPE_TERMINATOR           (5)
+#define IOEN_CAN_PORT_TYPE_RX                   (6)        /* Additional CAN bus input, after bus A and B  */
+#define IOEN_CAN_PORT_TYPE_TX                   (7)        /* Additional CAN bus output, after bus A and B */
 
 #define IOEN_A429_MAX_PORTS                     (6)        /* The A429 HW only has 6 receive channels */
 #define IOEN_A429_MAX_LABELS                    (256)      /* 8 bits are allowed for a Label Code     */
 #define IOEN_A429_MAX_SDI                       (4)        /* 2 bits are allowed for a Label SDI      */
+#define IOEN_A429_LABEL_BITMAP_WORDS            ((IOEN_A429_MAX_LABELS * IOEN_A429_MAX_SDI) / 32)  /* 32 bit words of the label presence bitmap of a port */
+#define IOEN_A429_MAX_CONFIGURED_LABELS         (IOEN_A429_MAX_PORTS * IOEN_A429_MAX_LABELS * IOEN_A429_MAX_SDI)  /* Configured labels (code and SDI) of all ports */
 #define IOEN_A429_READS_PER_PORT_PER_CYCLE      (16)        /* One A429 Label per read                 */
+#define IOEN_A429_BLOCK_WORDS                   (64)        /* A429 words per read in block receive mode */
+#define IOEN_A429_MAX_BLOCK_READS               (IOEN_A429_READS_PER_PORT_PER_CYCLE)  /* Reads per port and cycle in block receive mode, at least the single word reads */
+#define IOEN_A429_RATE_SHIFT                    (3)         /* Smoothing of the A429 label period and jitter, new value weighs 1/8 */
+#define IOEN_A429_FWD_MAX_WORDS                 (256)       /* Forwarded A429 words buffered per destination, sent when full or at the end of the read */
+#define IOEN_A429_FWD_NONE                      (0xFFFFFFFF) /* A429 port not forwarded                   */
+#define IOEN_A429_MIN_READS_PER_PORT            (2)         /* Adaptive budget: minimum single word reads per port and cycle */
+#define IOEN_A429_MAX_READS_PER_PORT            (64)        /* Adaptive budget: maximum single word reads per port and cycle */
+#define IOEN_A429_READ_BUDGET_CAP               (IOEN_A429_MAX_PORTS * IOEN_A429_READS_PER_PORT_PER_CYCLE)  /* Adaptive budget: reads of all ports per cycle */
+
+/* Limits of the reverse index used for incremental input processing */
+#define IOEN_INC_MAX_DATASETS                   (4096)                                                            /* AFDX/A429 input datasets             */
+#define IOEN_INC_MAX_A429_MESSAGES              (IOEN_A429_MAX_PORTS * IOEN_A429_MAX_LABELS * IOEN_A429_MAX_SDI)  /* A429 labels                          */
+#define IOEN_INC_MAX_MESSAGES                   (IOEN_MAX_RX_PORT_NUMBER + IOEN_INC_MAX_A429_MESSAGES)            /* AFDX messages followed by A429 labels */
+#define IOEN_INC_MAX_INDEX_ENTRIES              (16384)                                                           /* Message to dataset references        */
+
+#define IOEN_INC_DS_DIRTY                       (0x01)     /* A message of the dataset changed        */
+#define IOEN_INC_DS_ALWAYS                      (0x02)     /* Dataset is processed every cycle        */
+#define IOEN_INC_DS_PROCESSED                   (0x04)     /* Dataset was processed this cycle        */
+
+/* Limits of the change driven evaluation of the selection sets */
+#define IOEN_SS_MAX_INDEX_ENTRIES               (8192)     /* Message to selection set references     */
+#define IOEN_SS_SET_DIRTY                       (0x01)     /* Set is evaluated in the next cycle      */
+#define IOEN_SS_SET_ALWAYS                      (0x02)     /* Set is evaluated every cycle            */
+#define IOEN_SS_SET_LIC                         (0x04)     /* LIC parameters are checked every cycle  */
+
+/* Limits of the precompiled execution plan of the AFDX/A429 input processing */
+#define IOEN_EP_MAX_DATASETS                    (4096)     /* Single and multiple source datasets     */
+#define IOEN_EP_MAX_CONVERTS                    (8192)     /* Conversions of one signal of one source */
+#define IOEN_EP_MAX_COPIES                      (8192)     /* Parameters routed to the application    */
+#define IOEN_EP_MAX_SELECTIONS                  (1024)     /* Selection sets with a selection         */
+#define IOEN_EP_MAX_CONDITIONS                  (4096)     /* Distinct validity conditions            */
+#define IOEN_EP_MAX_CONDITION_REFS              (32768)    /* Validity conditions of all sources      */
+#define IOEN_EP_CONDITION_HASH_SIZE             (8192)     /* Lookup of distinct conditions, power of 2 */
+#define IOEN_EP_MAX_HOST_WORDS                  (8192)     /* AFDX signal words kept in host order    */
+#define IOEN_EP_NO_HOST_WORD                    (0xFFFFFFFF) /* Signal word not kept in host order    */
 
 /* Standard A429 LABEL defines */
 #define IOEN_A429_LABEL_OFFSET                  (0)
@@ -371,7 +434,7 @@ typedef struct CanMessageConfig_t
     UInt32_t freshTime;                 /* Max duration, before a message is marked as fresh in ms       */
     UInt32_t unfreshTime;               /* Max duration, before a message is marked as unfresh in ms     */
     UInt16_t size;                      /* Size of message structure plus size of corresponding mappings */
-    Byte_t   messageLength;             /* Length of message payload 1 - 8 bytes                         */
+    Byte_t   messageLength;             /* Length of message payload 1 - 8 bytes, 1 - 64 bytes (CAN FD)  */
     Byte_t   numMappings;               /* number of mappings                                            */
 } CanMessageConfig_t;
 
@@ -382,7 +445,7 @@ typedef struct CANMessage_t
     UInt32_t canId;     /* ID of CAN Message, includes Functional Status (FS) and Redundancy Channel Identifier (RCI) */
     UInt16_t nbytes;    /* Number of data types                                   */
     SInt16_t msgtype;   /* Reserved for test usage, set to 0 for normal operation */
-    Byte_t   data[8];   /* Payload of CAN message                                 */
+    Byte_t   data[IOEN_CAN_MAX_PAYLOAD];   /* Payload of CAN message              */
 
 } CANMessage_t;
 
@@ -395,7 +458,8 @@ typedef struct IOMCanRoutingPortTbl_t
     APEX_INTEGER  queueLength;          /* APEX Port Queue Length                                                */
     APEX_INTEGER  apexCanBusId;         /* APEX Port ID for a CAN bus                                            */
     APEX_INTEGER  nofOutMsg;            /* Number of messages in the output queue (to forward to this APEX Port) */
-    CANMessage_t  outMsg[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];  /* List of CAN message to be routed to this port     */
+    UInt32_t      ownerIdx;             /* Routing table entry that holds the output queue of this APEX Port     */
+    Byte_t        outIdx[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];  /* Index in the receive buffer of the messages to be routed to this port */
 } IOMCanRoutingPortTbl_t;
 
 /* A429 Port Configuration */
@@ -445,8 +509,8 @@ typedef struct ValidityConfig_t
 {
     UInt16_t                    numConditions;      /* Number of Validity Check conditions. Range [1..4].             */
     UInt16_t                    sourceSet;          /* corresponding set to which this source belongs to              */
-    Byte_t                      conditionType[4];   /* Validity Check conditions                                      */
-    ValidityConditionConfig_t   condition[4];       /* Array of Validity Check Condition                              */
+    Byte_t                      conditionType[IOEN_MAX_VALIDITY_CONDITIONS];   /* Validity Check conditions           */
+    ValidityConditionConfig_t   condition[IOEN_MAX_VALIDITY_CONDITIONS];       /* Array of Validity Check Condition   */
 } ValidityConfig_t;
 
 
@@ -456,7 +520,7 @@ typedef struct ValidityConfigCan_t
     UInt16_t                    numConditions;      /* Number of Validity Check conditions. Range [0..2].             */
     UInt16_t                    spare;              /* 32 bit alignment                                               */
     Byte_t                      conditionType[4];   /* Validity Check conditions, only two used                       */
-    ValidityConditionConfig_t   condition[2];       /* Array of Validity Check Condition                              */
+    ValidityConditionConfig_t   condition[IOEN_MAX_CAN_VALIDITY_CONDITIONS];   /* Array of Validity Check Condition   */
 } ValidityConfigCan_t;
 
 
@@ -43,21 +43,66 @@ typedef struct AfdxMessageHeader_t
 
 
 
-/* Control structure to perform the refreshing of data for A429 */
+/* Control data of a configured A429 label (code and SDI) */
 typedef struct A429MessageCtrlData_t
 {
-    A429MessageInfo_t    *msgInfo_p;      /* Also used as robustness, when not 0   */
-    IomObjectCtrlData_t   ctrl;           /* Used to calculate freshness of data   */
+    A429MessageInfo_t    *msgInfo_p;      /* Configuration of the label            */
+    UInt32_t              labelIdx;       /* Index of the label in the config      */
 } A429MessageCtrlData_t;
 
-/* Lookup structure to save searching configuration for label config each time */
+/*
+ * Lookup structure to save searching configuration for label config each time.
+ * Bit (code * 4 + sdi) of present is set for a configured label, the control data of the labels of a port
+ * are stored in ioen_a429LabelCtrl from entry first on, in the order of their bits.
+ * The entry of a label is first + rankBase[word] + number of set bits below the bit in its word.
+ */
 typedef struct A429MessageCtrl_t
 {
-    APEX_INTEGER          apexPortId;                                         /* Port ID returned by APEX create port function */
-    A429MessageCtrlData_t data[IOEN_A429_MAX_LABELS][IOEN_A429_MAX_SDI];      /* space for all labels of one port              */
+    APEX_INTEGER          apexPortId;                                   /* Port ID returned by APEX create port function */
+    UInt32_t              present[IOEN_A429_LABEL_BITMAP_WORDS];        /* Configured labels of the port                 */
+    UInt16_t              rankBase[IOEN_A429_LABEL_BITMAP_WORDS];       /* Configured labels in the words before         */
+    UInt32_t              first;                                        /* First entry of the port in ioen_a429LabelCtrl */
 } A429MessageCtrl_t;
 
 
+/* Receive mode, read budget and statistics of the A429 ports */
+typedef struct A429ReadCtrl_t
+{
+    Bool_t                block;          /* TRUE: a read returns all pending words of a port, up to IOEN_A429_BLOCK_WORDS */
+    Bool_t                adaptive;       /* TRUE: the single word reads per port follow the traffic of the port          */
+    UInt32_t              budget[IOEN_A429_MAX_PORTS];     /* Single word reads per cycle (adaptive budget)        */
+    UInt32_t              need[IOEN_A429_MAX_PORTS];       /* Reads needed in the last cycle                       */
+    UInt32_t              demand[IOEN_A429_MAX_PORTS];     /* Smoothed reads needed per cycle, in 1/16 reads       */
+    A429PortStatistics_t  stats[IOEN_A429_MAX_PORTS];
+} A429ReadCtrl_t;
+
+
+/* Arrival time and update rate of the A429 labels, per entry of ioen_a429LabelCtrl */
+typedef struct A429RateCtrl_t
+{
+    Bool_t                enabled;                                      /* TRUE: the arrivals are recorded                            */
+    SYSTEM_TIME_TYPE      now;                                          /* Time of the current port read                              */
+    A429LabelStatistics_t label[IOEN_A429_MAX_CONFIGURED_LABELS];
+} A429RateCtrl_t;
+
+
+/*
+ * Forwarding of received A429 words to another partition (transport_portindex of the routing table).
+ * The words are collected per destination port during the read, and sent at the end of the read.
+ */
+typedef struct A429FwdCtrl_t
+{
+    Bool_t                batch;                                        /* TRUE: up to IOEN_A429_BLOCK_WORDS words per send           */
+    UInt32_t              nofDest;                                      /* Destination ports in use                                   */
+    UInt32_t              destSlot[IOEN_A429_MAX_PORTS];                /* Destination of each input port, or IOEN_A429_FWD_NONE       */
+    UInt32_t              destTblIdx[IOEN_A429_MAX_PORTS];              /* Routing table entry of each destination                    */
+    UInt32_t              nofWords[IOEN_A429_MAX_PORTS];                /* Words collected per destination                            */
+    Bool_t                filtered[IOEN_A429_MAX_PORTS];                /* TRUE: only the labels in allow are forwarded, per input port */
+    UInt32_t              allow[IOEN_A429_MAX_PORTS][IOEN_A429_LABEL_BITMAP_WORDS];  /* Forwarded labels, bit (code * 4 + sdi) */
+    UInt32_t              words[IOEN_A429_MAX_PORTS][IOEN_A429_FWD_MAX_WORDS];      /* Words collected per destination        */
+} A429FwdCtrl_t;
+
+
 /* A429 Raw Data in message buffer per SDI */
 typedef struct A429RawData_t
 {
@@ -74,6 +119,163 @@ typedef struct A429MessageData_t
 
 
 
+/* Read schedule of the AFDX input ports */
+typedef struct AfdxReadSchedule_t
+{
+    UInt32_t           cycle;                                     /* Current cycle of the schedule                        */
+    UInt32_t           nofSampling;                               /* Number of sampling ports                             */
+    UInt16_t           sampling[IOEN_MAX_RX_PORT_NUMBER];         /* Sampling ports, read every cycle                     */
+    UInt16_t           slotFirst[IOEN_AFDX_SCHED_WHEEL_SIZE];     /* First queuing port per slot, or IOEN_AFDX_SCHED_END  */
+    UInt16_t           next[IOEN_MAX_RX_PORT_NUMBER];             /* Next queuing port in the same slot                   */
+} AfdxReadSchedule_t;
+
+
+
+/* Freshness deadline of one input message */
+typedef struct MsgDeadline_t
+{
+    UInt32_t           limitCycle;                                /* Cycles after the reception until the message is unfresh */
+    UInt32_t           deadline;                                  /* Cycle in which the message becomes unfresh           */
+    UInt16_t           next;                                      /* Next message in the same slot, or IOEN_FRESH_END     */
+    UInt16_t           prev;                                      /* Previous message in the same slot, or IOEN_FRESH_END */
+    Bool_t             expired;                                   /* TRUE = unfresh, the message is not in a slot         */
+    Bool_t             received;                                  /* TRUE = received this cycle, in the event list        */
+    UInt16_t           spare;                                     /* 32 bit alignment                                     */
+} MsgDeadline_t;
+
+/* Timing wheel of the freshness deadlines of the messages of one transport */
+typedef struct FreshnessWheel_t
+{
+    UInt32_t           cycle;                                     /* Current cycle of the wheel                           */
+    UInt32_t           nofEntries;                                /* Number of messages                                   */
+    UInt32_t           maxEntries;                                /* Size of entry_p and event_p                          */
+    UInt32_t           nofEvents;                                 /* Number of entries in event_p                         */
+    MsgDeadline_t     *entry_p;                                   /* Deadline per message                                 */
+    UInt16_t          *event_p;                                   /* Messages received, then also messages became unfresh */
+    UInt16_t           slotFirst[IOEN_FRESH_WHEEL_SIZE];          /* First fresh message per slot, or IOEN_FRESH_END      */
+} FreshnessWheel_t;
+
+
+
+/* Reverse index from input messages to the input datasets using them (incremental input processing) */
+typedef struct InputChangeIndex_t
+{
+    Bool_t             enabled;                                   /* Incremental processing requested by the application  */
+    Bool_t             valid;                                     /* Configuration fits in the index                      */
+    UInt16_t           spare;                                     /* 32 bit alignment                                     */
+    UInt32_t           nofDatasets;                               /* Number of single and multiple source datasets        */
+    UInt16_t           msgFirst[IOEN_INC_MAX_MESSAGES];           /* First entry in dataset[] per message                 */
+    UInt16_t           msgCount[IOEN_INC_MAX_MESSAGES];           /* Number of entries in dataset[] per message           */
+    UInt16_t           dataset[IOEN_INC_MAX_INDEX_ENTRIES];       /* Datasets using the message                           */
+    Byte_t             dsFlags[IOEN_INC_MAX_DATASETS];            /* IOEN_INC_DS_xxx flags per dataset                    */
+    UInt32_t           dsSelected[IOEN_INC_MAX_DATASETS];         /* Source routed by the last ioen_imaProcessDatasetValue */
+} InputChangeIndex_t;
+
+
+
+/* Index from input messages to the selection sets checking them (change driven source selection) */
+typedef struct SelectionChangeIndex_t
+{
+    Bool_t             enabled;                                   /* Change driven selection requested by the application */
+    Bool_t             valid;                                     /* Configuration fits in the index                      */
+    Bool_t             listed;                                    /* Only the sets in eval[] are evaluated this cycle     */
+    Byte_t             spare;                                     /* 32 bit alignment                                     */
+    UInt32_t           fullSweepInterval;                         /* Cycles between evaluations of all sets, 0 = never    */
+    UInt32_t           sweepCycle;                                /* Cycles since the last evaluation of all sets         */
+    UInt32_t           nofSets;                                   /* Number of selection sets                             */
+    UInt32_t           nofWatched;                                /* Number of entries in watched[]                       */
+    UInt32_t           nofDirty;                                  /* Number of entries in dirty[]                         */
+    UInt32_t           nofEval;                                   /* Number of entries in eval[]                          */
+    const SelectionSetConfig_t *setConfig_p[IOEN_MAX_NUMBER_OF_SELECTION_SETS]; /* Configuration per set              */
+    UInt16_t           msgFirst[IOEN_INC_MAX_MESSAGES];           /* First entry in set[] per message                     */
+    UInt16_t           msgCount[IOEN_INC_MAX_MESSAGES];           /* Number of entries in set[] per message               */
+    UInt16_t           set[IOEN_SS_MAX_INDEX_ENTRIES];            /* OBJECT_VALID sets checking the message               */
+    UInt16_t           watched[IOEN_MAX_NUMBER_OF_SELECTION_SETS];/* Sets checked every cycle (ALWAYS, LIC)               */
+    UInt16_t           dirty[IOEN_MAX_NUMBER_OF_SELECTION_SETS];  /* Sets marked for the next cycle                       */
+    UInt16_t           eval[IOEN_MAX_NUMBER_OF_SELECTION_SETS];   /* Sets evaluated this cycle                            */
+    Byte_t             setFlags[IOEN_MAX_NUMBER_OF_SELECTION_SETS]; /* IOEN_SS_SET_xxx flags per set                      */
+} SelectionChangeIndex_t;
+
+
+
+/* Precompiled conversion of one input signal of one source */
+typedef struct ExecPlanConvert_t
+{
+    const ParamMappingConfig_t *parConfig_p;                      /* Parameter of the signal                              */
+    const InputSignalConfig_t  *sigConfig_p;                      /* Signal of the source                                 */
+    const Validity_t           *validity_p;                       /* Current validity of the source                       */
+    const UInt32_t             *hostWord_p;                       /* Signal word in host byte order, or NULL_PTR          */
+    UInt32_t                    hostSlot;                         /* Entry in hostWord[], or IOEN_EP_NO_HOST_WORD         */
+    UInt32_t                    dsIdx;                            /* Dataset of the signal                                */
+} ExecPlanConvert_t;
+
+/* Distinct validity condition, evaluated at most once per cycle */
+typedef struct ExecPlanCondition_t
+{
+    const ValidityConditionConfig_t *condition_p;                 /* First occurrence of the condition                    */
+    UInt32_t                    conditionType;                    /* IOEN_VALIDITY_CONDITION_TYPE_xxx                     */
+    UInt32_t                    cycle;                            /* Cycle in which validity was evaluated                */
+    Validity_t                  validity;                         /* Validity of the condition in that cycle              */
+} ExecPlanCondition_t;
+
+/* Precompiled routing of one parameter to the application */
+typedef struct ExecPlanCopy_t
+{
+    const ParamMappingConfig_t *parConfig_p;                      /* Parameter                                            */
+    const InputSignalConfig_t  *sigConfig_p;                      /* Signal of the first source                           */
+} ExecPlanCopy_t;
+
+/* Precompiled dataset, the index is the index in ioen_inObjectCtrl */
+typedef struct ExecPlanDataset_t
+{
+    const InputDatasetHeader_t *dataset_p;                        /* Dataset in the IOM configuration                     */
+    const ValidityConfig_t     *validityLogic_p;                  /* First validity logic of the dataset                  */
+    UInt16_t                    firstCopy;                        /* First entry in copy[]                                */
+    UInt16_t                    nofCopies;                        /* Number of entries in copy[]                          */
+    UInt32_t                    firstCondRef;                     /* Conditions of all sources, first entry in condRef[]  */
+} ExecPlanDataset_t;
+
+/* Precompiled selection set */
+typedef struct ExecPlanSelection_t
+{
+    const SelectionSetConfig_t *setConfig_p;                      /* Set in the IOM configuration                         */
+    UInt32_t                    curSet;                           /* Index of the set in ioen_selectionSetlist            */
+} ExecPlanSelection_t;
+
+/* Execution plan of the AFDX/A429 input processing, compiled from the IOM configuration at start up */
+typedef struct InputExecPlan_t
+{
+    Bool_t             enabled;                                   /* Plan requested by the application                    */
+    Bool_t             valid;                                     /* Configuration fits in the plan                       */
+    Bool_t             hostOrder;                                 /* Host byte order words requested by the application   */
+    Bool_t             hostValid;                                 /* Signal words fit in hostWord[]                       */
+    UInt32_t           nofSingle;                                 /* Single source datasets, first in dataset[]           */
+    UInt32_t           nofMulti;                                  /* Multiple source datasets, following the single ones  */
+    UInt32_t           nofConverts;                               /* Used entries in convert[]                            */
+    UInt32_t           nofCopies;                                 /* Used entries in copy[]                               */
+    UInt32_t           nofSelections;                             /* Used entries in selection[]                          */
+    UInt16_t           typeFirst[IOEN_NUMBER_INPUT_MAPPING_TYPES];  /* First entry in convert[] per input mapping type    */
+    UInt16_t           typeCount[IOEN_NUMBER_INPUT_MAPPING_TYPES];  /* Number of entries in convert[] per mapping type    */
+    Byte_t             dsActive[IOEN_EP_MAX_DATASETS];            /* Dataset processed in the current cycle               */
+    ExecPlanDataset_t  dataset[IOEN_EP_MAX_DATASETS];
+    ExecPlanConvert_t  convert[IOEN_EP_MAX_CONVERTS];             /* Conversions grouped by input mapping type            */
+    ExecPlanCopy_t     copy[IOEN_EP_MAX_COPIES];
+    ExecPlanSelection_t selection[IOEN_EP_MAX_SELECTIONS];
+    UInt32_t           condCycle;                                 /* Current cycle of the condition cache                 */
+    UInt32_t           nofConditions;                             /* Used entries in condition[]                          */
+    UInt32_t           nofCondRefs;                               /* Used entries in condRef[]                            */
+    ExecPlanCondition_t condition[IOEN_EP_MAX_CONDITIONS];
+    UInt16_t           condRef[IOEN_EP_MAX_CONDITION_REFS];       /* Distinct condition of each condition of each source  */
+    UInt16_t           condHash[IOEN_EP_CONDITION_HASH_SIZE];     /* Entry in condition[] + 1, or 0 if free               */
+    UInt32_t           nofHostWords;                              /* Used entries in hostWord[]                           */
+    UInt16_t           msgWordFirst[IOEN_MAX_RX_PORT_NUMBER];     /* First entry in hostWord[] per AFDX message           */
+    UInt16_t           msgWordCount[IOEN_MAX_RX_PORT_NUMBER];     /* Number of entries in hostWord[] per AFDX message     */
+    UInt32_t           wordOffset[IOEN_EP_MAX_HOST_WORDS];        /* Offset of the word in the input message buffer       */
+    UInt32_t           hostWord[IOEN_EP_MAX_HOST_WORDS];          /* Signal words of the AFDX messages in host byte order */
+} InputExecPlan_t;
+
+
+
 /* Output Port Information */
 typedef struct OutputPortInfo_t
 {
@@ -90,6 +292,20 @@ typedef struct OutputPortsInfo_t
     OutputPortInfo_t   port[IOEN_MAX_TX_PORT_NUMBER];
 } OutputPortsInfo_t;
 
+/* Transmit schedule of the CAN output messages */
+typedef struct CanTxSchedule_t
+{
+    UInt32_t                   cycle;                                  /* Current cycle of the schedule                     */
+    UInt32_t                   nofDue;                                 /* Number of messages due in the current cycle       */
+    const CanMessageConfig_t  *msgCfg_p[IOEN_MAX_TX_PORT_NUMBER];      /* Configuration per output message                  */
+    UInt32_t                   sendCycle[IOEN_MAX_TX_PORT_NUMBER];     /* Cycle of the next transmission per message        */
+    UInt32_t                   period[IOEN_MAX_TX_PORT_NUMBER];        /* Transmission period per message in App Periods    */
+    UInt16_t                   slotFirst[IOEN_CAN_TX_WHEEL_SIZE];      /* First message per slot, or IOEN_CAN_TX_END        */
+    UInt16_t                   next[IOEN_MAX_TX_PORT_NUMBER];          /* Next message in the same slot                     */
+    UInt16_t                   due[IOEN_MAX_TX_PORT_NUMBER];           /* Messages due in the current cycle, in config order */
+    CANMessage_t               frame[IOEN_MAX_TX_PORT_NUMBER];         /* Frames of the due messages, sent to each bus      */
+} CanTxSchedule_t;
+
 
 
 /************************************************************************/
@@ -102,6 +318,8 @@ typedef struct SelectionSetInfo_t
     UInt32_t                    healthScore [IOEN_MAX_SOURCES_PER_INPUT];      /* number of parameters in this source with an FS of NO     */
     IomObjectCtrlData_t         ctrl[IOEN_MAX_SOURCES_PER_INPUT];              /* Used to calculate freshness of set validity              */
     IomObjectCtrlData_t         lock[IOEN_MAX_SOURCES_PER_INPUT];              /* Used to calculate the lock interval of the source        */
+    UInt32_t                    licValue[IOEN_MAX_SOURCES_PER_INPUT];          /* LIC parameter value at the last evaluation               */
+    UInt32_t                    licValidity[IOEN_MAX_SOURCES_PER_INPUT];       /* LIC parameter validity at the last evaluation            */
 } SelectionSetInfo_t;
 
 
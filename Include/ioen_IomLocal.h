@@ -55,6 +55,8 @@ extern       Byte_t                      *ioen_outMsgBuffer;
 extern       const IOMConfigHeader_t     *ioen_iomConfig_p;
 
 extern       const UInt32_t               crc32LookupTable[IOEN_CRC32_TABLE_SIZE];
+extern       UInt32_t                     ioen_crc32SliceTable[IOEN_CRC32_SLICES][IOEN_CRC32_TABLE_SIZE];
+extern       UInt32_t                   (*ioen_crc32Engine)(UInt32_t, const Byte_t *, const UInt32_t);
 
 extern       Bool_t                       ioen_icBoolIsIntegerConverter;
 extern       Float32_t                    ioen_processPeriodicTimeMs;
@@ -65,13 +67,28 @@ extern       Bool_t                       ioen_outBoolIsInteger;
 
 
 extern void       (*ioen_inputConverters[IOEN_NUMBER_INPUT_MAPPING_TYPES])(const Validity_t, const ParamMappingConfig_t*, const InputSignalConfig_t*, const Byte_t *, Byte_t *);
+extern void       (*ioen_inputBatchConverters[IOEN_NUMBER_INPUT_MAPPING_TYPES])(const ExecPlanConvert_t *, const UInt32_t, const Byte_t *, const Byte_t *, Byte_t *);
 extern Validity_t (*ioen_validityChecker[IOEN_NUMBER_CONDITION_TYPES])(const Byte_t *, const ValidityConditionConfig_t *);
 extern void       (*ioen_outputConverters[IOEN_NUMBER_OUTPUT_MAPPING_TYPES])(const ParamMappingConfig_t*, const InputSignalConfig_t*, const Byte_t *, Byte_t *);
 
 extern IomMessageCtrlData_t ioen_afdxMsgCtrl        [IOEN_MAX_RX_PORT_NUMBER]; /* one entry per message (AFDX) */
 extern A429MessageCtrl_t    ioen_a429MsgControl     [IOEN_A429_MAX_PORTS];     /* one entry per message (A429) */
-
-extern OutputPortsInfo_t    ioen_outputPortsInfoCan;
+extern A429ReadCtrl_t       ioen_a429Read;                                     /* receive mode of A429 ports   */
+extern A429FwdCtrl_t        ioen_a429Fwd;                                      /* forwarding of A429 words     */
+extern A429RateCtrl_t       ioen_a429Rate;                                     /* update rate of A429 labels   */
+extern A429MessageCtrlData_t ioen_a429LabelCtrl     [IOEN_A429_MAX_CONFIGURED_LABELS]; /* configured labels (A429) */
+extern AfdxReadSchedule_t   ioen_afdxReadSchedule;                             /* read schedule of AFDX ports  */
+extern FreshnessWheel_t     ioen_afdxFreshness;                                /* freshness of AFDX messages   */
+extern MsgDeadline_t        ioen_afdxDeadline       [IOEN_MAX_RX_PORT_NUMBER]; /* one entry per message (AFDX) */
+extern UInt16_t             ioen_afdxFreshEvent     [IOEN_MAX_RX_PORT_NUMBER]; /* one entry per message (AFDX) */
+extern FreshnessWheel_t     ioen_a429Freshness;                                /* freshness of A429 labels     */
+extern MsgDeadline_t        ioen_a429Deadline       [IOEN_INC_MAX_A429_MESSAGES];/* one entry per label (A429)   */
+extern UInt16_t             ioen_a429FreshEvent     [IOEN_INC_MAX_A429_MESSAGES];/* one entry per label (A429)   */
+extern InputChangeIndex_t   ioen_inputChangeIndex;                             /* message to dataset index     */
+extern SelectionChangeIndex_t ioen_selectionChangeIndex;                       /* message to set index         */
+extern InputExecPlan_t      ioen_inputExecPlan;                                /* input execution plan         */
+
+extern CanTxSchedule_t      ioen_canTxSchedule;
 extern OutputPortsInfo_t    ioen_outputPortsInfoAfdx;
 
 
@@ -89,6 +106,10 @@ void        ioen_aaInitOutputBuffer (
                 /*    OUT */       Byte_t              * const outMessageBuffer_p
             );
 
+void        ioen_aaInitReadSchedule (
+                /* IN     */ const IOMConfigHeader_t   * const iom_p
+            );
+
 void        ioen_aaNewMessageAfdx (
                 /* IN     */ const AfdxMessageInfo_t        * const msginfo_p,
                 /* IN     */ const void                     * const messageStart_p,
@@ -345,11 +366,50 @@ void        ioen_icMsgUnfresh (
                 /* IN     */       Byte_t               * const inParamBuffer
             );
 
+void        ioen_icBatch32bUInt (
+                /* IN     */ const ExecPlanConvert_t    * const convert_p,
+                /* IN     */ const UInt32_t                     nofConverts,
+                /* IN     */ const Byte_t               * const dsActive,
+                /* IN     */ const Byte_t               * const inMsgBuffer,
+                /* IN     */       Byte_t               * const inParamBufferSrc
+            );
+
+void        ioen_icBatch32bInt (
+                /* IN     */ const ExecPlanConvert_t    * const convert_p,
+                /* IN     */ const UInt32_t                     nofConverts,
+                /* IN     */ const Byte_t               * const dsActive,
+                /* IN     */ const Byte_t               * const inMsgBuffer,
+                /* IN     */       Byte_t               * const inParamBufferSrc
+            );
+
+void        ioen_icBatchA429BNR (
+                /* IN     */ const ExecPlanConvert_t    * const convert_p,
+                /* IN     */ const UInt32_t                     nofConverts,
+                /* IN     */ const Byte_t               * const dsActive,
+                /* IN     */ const Byte_t               * const inMsgBuffer,
+                /* IN     */       Byte_t               * const inParamBufferSrc
+            );
+
+void        ioen_icBatchA429UBNR (
+                /* IN     */ const ExecPlanConvert_t    * const convert_p,
+                /* IN     */ const UInt32_t                     nofConverts,
+                /* IN     */ const Byte_t               * const dsActive,
+                /* IN     */ const Byte_t               * const inMsgBuffer,
+                /* IN     */       Byte_t               * const inParamBufferSrc
+            );
+
 void        ioen_icInitInputConverter (
                 /* IN     */ const Bool_t                       bool_is_int
             );
 
 
+void        ioen_imaCopyParamToParamBuffer (
+                /* IN     */ const ParamMappingConfig_t * const curParam_p,
+                /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+                /* IN     */ const UInt32_t                     selectedSource,
+                /* IN     */ const Valid_t              * const valid_p
+            );
+
 void        ioen_imaCopyToParamBuffer (
                 /* IN     */ const ParamMappingConfig_t * const parConfig_p,
                 /* IN     */ const UInt16_t                     numParams,
@@ -455,6 +515,11 @@ Validity_t  ioen_vcCheckCondition_RangeFloatBnr (
     /* IN     */ const ValidityConditionConfig_t * const conditionConfig_p
 );
 
+void        ioen_ssCombineValidity (
+                /* IN OUT */       Validity_t                   * const validityFinal_p,
+                /* IN     */ const Validity_t                           validityCondition
+            );
+
 Validity_t  ioen_ssCheckSourceValidity(
                 /* IN     */ const Byte_t                   * const inMsgBuffer_p,
                 /* IN     */ const ValidityConfig_t         * const validityConfig_p
@@ -489,6 +554,18 @@ void        ioen_ssPerformObjectValidSelection (
                 /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
             );
 
+void        ioen_ssPerformSetSelection (
+                /* IN     */ const IOMConfigHeader_t       * const iom_p,
+                /* IN     */ const UInt32_t                        curSet,
+                /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
+            );
+
+void        ioen_ssCalcSetObjects (
+                /* IN     */ const IOMConfigHeader_t       * const iom_p,
+                /* IN     */ const UInt32_t                        curSet,
+                /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
+            );
+
 void        ioen_ssPerformSourceSelection (
                 /* IN     */ const IOMConfigHeader_t    * const iom_p
             );
@@ -497,6 +574,22 @@ void        ioen_ssCalcSourceSelectionObjects (
                 /* IN     */ const IOMConfigHeader_t    * const iom_p
             );
 
+void        ioen_ssMarkMessage (
+                /* IN     */ const UInt32_t                    key
+            );
+
+Bool_t      ioen_ssCollectSets (
+                /*        */       void
+            );
+
+void        ioen_ssCalcListedSets (
+                /* IN     */ const IOMConfigHeader_t    * const iom_p
+            );
+
+void        ioen_ssPerformListedSets (
+                /* IN     */ const IOMConfigHeader_t    * const iom_p
+            );
+
 void        ioen_ssInitSourceSelection(
                 /* IN     */ const IOMConfigHeader_t   * const iom_p,
                 /* IN     */ const Float32_t                   appPeriodMs
@@ -659,6 +752,12 @@ UInt32_t    ioen_im4GetA429Sdi(
                /* IN     */ const UInt32_t   a429word
             );
 
+A429MessageCtrlData_t * ioen_im4FindLabel (
+               /* IN     */ const UInt32_t   portIdx,
+               /* IN     */ const UInt32_t   labelId,
+               /* IN     */ const UInt32_t   sdi
+            );
+
 void        ioen_im4ProcessA429Message(
                 /* IN     */ const UInt32_t                    portIdx,
                 /* IN     */ const UInt32_t                    a429Label
@@ -668,13 +767,6 @@ void        ioen_updateMessageFreshness (
                 /*        */ void
             );
 
-void        ioen_ConfirmInitMsg (
-    /* IN     */ const UInt32_t                      freshTime,
-    /* IN     */ const UInt32_t                      unfreshTime,
-    /* IN     */ const Float32_t                     appPeriodMs,
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p
-);
-
 void        ioen_ConfirmInitParam (
     /* IN     */ const IOMConfigHeader_t        * const iom_p,
     /* IN     */ const Float32_t                        appPeriodMs,
@@ -718,10 +810,6 @@ void        ioen_ConfirmInitParamValidity (
     /* IN OUT */       IomObjectCtrlData_t              ctrl[IOEN_MAX_SOURCES_PER_INPUT]
 );
 
-void        ioen_ConfirmSetNewMsgData (
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p
-);
-
 void        ioen_ConfirmObjectValidity (
     /* IN     */ const UInt32_t                         nofSources,
     /* IN OUT */       IomObjectCtrlData_t              ctrl[IOEN_MAX_SOURCES_PER_INPUT]
@@ -731,9 +819,83 @@ void        ioen_ConfirmObjectValidityItem (
     /* IN OUT */       IomObjectCtrlData_t      * const ctrl_p
 );
 
-void        ioen_ConfirmMsgFreshness (
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p,
-    /* IN OUT */       UInt32_t              * const value_p
+void        ioen_frInitWheel (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */       MsgDeadline_t      * const entry_p,
+    /* IN     */       UInt16_t           * const event_p,
+    /* IN     */ const UInt32_t                   maxEntries
+);
+
+void        ioen_frInitEntry (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx,
+    /* IN     */ const UInt32_t                   unfreshTime,
+    /* IN     */ const Float32_t                  appPeriodMs
+);
+
+void        ioen_frNewData (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+);
+
+void        ioen_frRearm (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+);
+
+Bool_t      ioen_frIsExpired (
+    /* IN     */ const FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+);
+
+void        ioen_frUpdate (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p
+);
+
+void        ioen_frClearEvents (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p
+);
+
+void        ioen_incInitIndex (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+);
+
+UInt32_t    ioen_incMessageKey (
+    /* IN     */ const UInt32_t                     transport,
+    /* IN     */ const UInt32_t                     msgIdx
+);
+
+void        ioen_incMarkAllDatasets (
+    /*        */       void
+);
+
+void        ioen_incMarkMessage (
+    /* IN     */ const UInt32_t                    transport,
+    /* IN     */ const UInt32_t                    msgIdx
+);
+
+Bool_t      ioen_incSkipDataset (
+    /* IN     */ const UInt32_t                         dsIdx,
+    /* IN     */ const InputDatasetHeader_t     * const dataset_p,
+    /* IN     */ const Bool_t                           singleSource,
+    /* IN     */ const IomObjectCtrlData_t              objectCtrl[IOEN_MAX_SOURCES_PER_INPUT]
+);
+
+Bool_t      ioen_incSkipDatasetValue (
+    /* IN     */ const UInt32_t                         dsIdx,
+    /* IN     */ const InputDatasetHeader_t     * const dataset_p
+);
+
+void        ioen_epCompilePlan (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+);
+
+void        ioen_epProcessInput (
+    /*        */       void
+);
+
+void        ioen_epCanonicalizeMessage (
+    /* IN     */ const UInt32_t                     msgIdx
 );
 
 void        ioen_AfdxInitSignalConfirmation (
@@ -741,6 +903,22 @@ void        ioen_AfdxInitSignalConfirmation (
     /* IN     */ const Float32_t                   appPeriodMs
 );
 
+void        ioen_UtilInitCrc (
+   /*        */       void
+);
+
+UInt32_t    ioen_UtilCrcBytewise (
+   /* IN     */       UInt32_t                   crc32,
+   /* IN     */ const Byte_t             * const data_p,
+   /* IN     */ const UInt32_t                   nofBytes
+);
+
+UInt32_t    ioen_UtilCrcSlice8 (
+   /* IN     */       UInt32_t                   crc32,
+   /* IN     */ const Byte_t             * const data_p,
+   /* IN     */ const UInt32_t                   nofBytes
+);
+
 Bool_t      ioen_UtilCheckCrc (
    /* IN     */ const Byte_t             * const data_p,
    /* IN     */ const AfdxMessageInfo_t  * const msginfo_p
@@ -768,4 +946,8 @@ Bool_t ioen_UtilIsZero (
    /* IN     */       UInt32_t                   nofBytes
 );
 
+UInt32_t ioen_UtilPopCount (
+   /* IN     */ const UInt32_t                   word
+);
+
 #endif
@@ -21,7 +21,9 @@
 
 
 
-#define IOEN_MAX_CAN_PORT_NUMBER        ( 2)
+#define IOEN_MAX_CAN_PORT_NUMBER        ( 8)          /* Maximum number of CAN input buses and of CAN output buses */
+#define IOEN_CAN_BUS_NONE               (0xFF)        /* No bus selected for a CAN message                         */
+#define IOEN_CAN_MAX_RCI                ( 4)          /* 2 bits Redundancy Channel Identifier                      */
 #define IOEN_CAN_PORT_QUEUE_LEN         ( 1)
 
 #define A825_CAN_ID_IGNORE_FS_MASK      (0x1FFFFFF3) /* mask unused top 3 bits, FS                                   (bits 0 and 1 = RCI, bits 2 and 3 = FS) */
@@ -40,6 +42,91 @@
 
 
 
+/*
+ * Frame filter of one CAN message, resolved from the rule table at start up.
+ * The data bytes are compared in 64 bit words, the masks are in memory byte order.
+ */
+typedef struct CanFrameFilter_t
+{
+    Bool_t                     enabled;       /* FALSE: every frame is a new message */
+    Byte_t                     tailBytes;
+    Byte_t                     nofIdle;
+    UInt64_t                   cmpMask[IOEN_CAN_PAYLOAD_WORDS];
+    UInt64_t                   idle[IOEN_CAN_FILTER_MAX_IDLE][IOEN_CAN_PAYLOAD_WORDS];
+} CanFrameFilter_t;
+
+
+/*
+ * Drain mode and receive statistics of the CAN buses
+ */
+typedef struct CanDrainCtrl_t
+{
+    Bool_t                     enabled;       /* TRUE: read each bus until empty or budget used up */
+    Bool_t                     reader;        /* TRUE: read from ioen_canRxRing, filled by ioen_runCanReader */
+    UInt32_t                   frameBudget;   /* Max CAN messages per bus and cycle, 0 = no limit  */
+    SYSTEM_TIME_TYPE           timeBudget;    /* Max read time per bus and cycle in ns, 0 = no limit */
+    CanBusStatistics_t         stats[IOEN_MAX_CAN_PORT_NUMBER];
+} CanDrainCtrl_t;
+
+
+/*
+ * Receive ring of one CAN bus, between the reader process (producer) and the IOM cycle (consumer).
+ * Only the reader writes head, only the cycle writes tail, the indices run freely and wrap at 2^32.
+ */
+typedef struct CanRxRing_t
+{
+    volatile UInt32_t          head;          /* Next slot written by the reader                  */
+    volatile UInt32_t          tail;          /* Next slot read by the cycle                      */
+    UInt32_t                   fullStops;     /* Reader runs stopped by a full ring, reader only  */
+    UInt32_t                   fullStopsRead; /* fullStops at the last clear of the statistics    */
+    SYSTEM_TIME_TYPE           arrival[IOEN_CAN_RING_SIZE];  /* Time the message was read from the driver */
+    CANMessage_t               frame[IOEN_CAN_RING_SIZE];
+} CanRxRing_t;
+
+
+/*
+ * Compiled mapping of one parameter of a CAN input message, built by ioen_imcCompileMappings.
+ * The buffer addresses, the converter and the validity checks are resolved from the configuration.
+ */
+typedef struct CanMapDesc_t
+{
+    const simpleMapConfigCanIn_t  *map_p;        /* Configuration of the mapping, passed to the converter and the checks */
+    void                         (*convert)(const Validity_t, const ParamMappingConfig_t*, const InputSignalConfig_t*, const Byte_t *, Byte_t *);
+    Validity_t                   (*check[IOEN_MAX_CAN_VALIDITY_CONDITIONS])(const Byte_t *, const ValidityConditionConfig_t *);
+    UInt32_t                      *srcVal_p;     /* Validity in the source buffer                    */
+    UInt32_t                      *dstVal_p;     /* Validity in the parameter buffer                 */
+    Byte_t                        *srcPar_p;     /* Value in the source buffer                       */
+    Byte_t                        *dstPar_p;     /* Value in the parameter buffer                    */
+    UInt16_t                       parBytes;     /* Size of the value, 4 is copied as one word       */
+    Byte_t                         internal;     /* TRUE: no source, the parameter is always valid   */
+    Byte_t                         nofChecks;    /* Validity checks, only evaluated while valid      */
+} CanMapDesc_t;
+
+
+/*
+ * Byte range of a parameter buffer, cleared at the start of each cycle
+ */
+typedef struct CanResetRange_t
+{
+    UInt32_t                   offset;        /* Offset in the buffer, in bytes */
+    UInt32_t                   size;          /* Size of the range, in bytes    */
+} CanResetRange_t;
+
+
+/*
+ * Accumulators of the INT8_ADD mappings of all CAN input messages, merged into ranges
+ * of adjacent words, built by ioen_imcInitResetRanges.
+ */
+typedef struct CanResetRanges_t
+{
+    Bool_t                     walk;          /* TRUE: too many accumulators, walk the configuration */
+    UInt32_t                   nofSrc;
+    UInt32_t                   nofPar;
+    CanResetRange_t            src[IOEN_CAN_MAX_RESET_WORDS];   /* Ranges in ioen_inParamBufferSrc */
+    CanResetRange_t            par[IOEN_CAN_MAX_RESET_WORDS];   /* Ranges in ioen_inParamBuffer    */
+} CanResetRanges_t;
+
+
 /*
  * Control structure for can messages.
  * Used to handle bus channel switching according to ICD: CDS
@@ -47,11 +134,17 @@
 typedef struct CANMessageControl_t
 {
     UInt32_t                   canIdMasked;
-    UInt32_t                   lastbus;       /* Stores the APEX ID returned by CREATE_QUEUING_PORT range 1..number of ports */
-    const CanMessageConfig_t  *msgConfigSource1_p;  /* RCI = 0 */
-    const CanMessageConfig_t  *msgConfigSource2_p;  /* RCI = 1 */
+    Byte_t                     lastBus;       /* Index of the selected bus in ioen_apexCanBusIdRx, IOEN_CAN_BUS_NONE before the first message */
+    Byte_t                     spare[3];      /* 32 bit alignment */
+    const CanMessageConfig_t  *msgConfigFirst_p;                    /* First configured source, used for invalidation */
+    const CanMessageConfig_t  *msgConfigSource_p[IOEN_CAN_MAX_RCI]; /* Configuration per RCI, NULL if not configured  */
+    UInt16_t                   mapFirst[IOEN_CAN_MAX_RCI];          /* First descriptor in ioen_canMapPlan per RCI, or IOEN_CAN_MAP_NONE */
+    UInt16_t                   mapInvalidate;                       /* First descriptor of msgConfigFirst_p, or IOEN_CAN_MAP_NONE        */
+    UInt16_t                   spare2;        /* 32 bit alignment */
+    SYSTEM_TIME_TYPE           lastArrival;   /* Arrival time of the last message taken from the selected bus */
     IomObjectCtrlData_t        msgValidCtrl;
     CANMessage_t               prevMsg;       /* Used to store the previous message for filtering purposes */
+    CanFrameFilter_t           filter;        /* Filter of unchanged frames                                */
 } CANMessageControl_t;
 
 
@@ -62,10 +155,22 @@ typedef struct CANMessageControl_t
  */
 
 extern       CANMessageControl_t      ioen_mrcCanMessageControl[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
-extern       APEX_INTEGER             ioen_apexCanBusIdRxA;
-extern       APEX_INTEGER             ioen_apexCanBusIdRxB;
-extern       APEX_INTEGER             ioen_apexCanBusIdTxA;
-extern       APEX_INTEGER             ioen_apexCanBusIdTxB;
+extern       UInt16_t                 ioen_canIdHash[IOEN_CAN_ID_HASH_SIZE];
+extern const UInt64_t                 ioen_canLenMask[9];
+extern       CanDrainCtrl_t           ioen_canDrain;
+extern       CanRxRing_t              ioen_canRxRing[IOEN_MAX_CAN_PORT_NUMBER];
+extern       CanMapDesc_t             ioen_canMapPlan[IOEN_CAN_MAX_MAPPINGS];
+extern       CanResetRanges_t         ioen_canReset;
+extern       UInt32_t                 ioen_nofCanMapDesc;
+extern const CanFilterRule_t         *ioen_canFilterRules_p;
+extern       UInt32_t                 ioen_nofCanFilterRules;
+extern       FreshnessWheel_t         ioen_canFreshness;
+extern       MsgDeadline_t            ioen_canDeadline[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
+extern       UInt16_t                 ioen_canFreshEvent[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
+extern       APEX_INTEGER             ioen_apexCanBusIdRx[IOEN_MAX_CAN_PORT_NUMBER];
+extern       APEX_INTEGER             ioen_apexCanBusIdTx[IOEN_MAX_CAN_PORT_NUMBER];
+extern       UInt32_t                 ioen_nofCanRxBuses;
+extern       UInt32_t                 ioen_nofCanTxBuses;
 extern       UInt32_t                 ioen_nofCanMessages;
 extern       IOMCanRoutingPortTbl_t * ioen_mrcConfigRoutingTable_p;
 
@@ -76,6 +181,27 @@ void        ioen_imcDoOneInputMapping (
             );
 
 
+void        ioen_imcInitResetRanges (
+               /* IN     */ void
+            );
+
+void        ioen_imcCompileMappings (
+               /* IN     */ void
+            );
+
+UInt64_t    ioen_imcWordMask (
+               /* IN     */ const UInt32_t   nofBytes,
+               /* IN     */ const UInt32_t   wordIdx
+            );
+
+void        ioen_imcInitFilter (
+               /* IN OUT */       CANMessageControl_t    * const msgctrl_p
+            );
+
+UInt32_t    ioen_imcFindSlot (
+               /* IN     */ const UInt32_t                       canIdMasked
+            );
+
 void        ioen_imcLookupMessage (
                /* IN     */ const UInt32_t                       canId,
                /*    OUT */ const CanMessageConfig_t          ** msgConfig_p,
@@ -86,8 +212,31 @@ void        ioen_imcCheckMessageFreshness (
                /* IN     */ void
             );
 
+void        ioen_imcHandleFrames (
+               /* IN     */ const UInt32_t                 busIdx,
+               /* IN OUT */       CANMessage_t     * const canMsgBuffer_p,
+               /* IN     */ const SYSTEM_TIME_TYPE * const arrival_p,
+               /* IN     */ const UInt32_t                 nofCanMsg
+            );
+
+void        ioen_imcFillRing (
+               /* IN     */ const SInt32_t                 apexCanBusId,
+               /* IN     */ const UInt32_t                 busIdx
+            );
+
+UInt32_t    ioen_imcTakeRing (
+               /* IN     */ const UInt32_t                 busIdx,
+               /*    OUT */       CANMessage_t     * const canMsgBuffer_p,
+               /*    OUT */       SYSTEM_TIME_TYPE * const arrival_p
+            );
+
+void        ioen_imcSendRoutedMessages (
+               /* IN     */ const CANMessage_t     * const canMsgBuffer_p
+            );
+
 void        ioen_imcHandleBus (
-               /* IN     */ const SInt32_t   portId
+               /* IN     */ const SInt32_t   apexCanBusId,
+               /* IN     */ const UInt32_t   busIdx
             );
 
 void        ioen_imcProcessCanMessage (
@@ -43,5 +43,12 @@
 #define IOEN_A664MSG_HEADER_EXTRA_PADDING IOEN_IMA_A664HEADER_PADDING_SIZE
 #endif
 
+/* Orders the memory accesses of two processes that share data without a lock (CAN reader rings) */
+#ifdef __GNUC__
+#define IOEN_MEMORY_BARRIER() __sync_synchronize()
+#else
+#error "IOEN_MEMORY_BARRIER not defined for this compiler"
+#endif
+
 #endif /* IOEN_PLATFORM_H_ */
 
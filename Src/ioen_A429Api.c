@@ -27,9 +27,14 @@ extern IOMA429RoutingPortTbl_t *ioen_429ConfigRoutingTable_p;
  *
  * DESCRIPTION:
  *   This function creates A429 Rx ports, and initialises the runtime data structures
+ *   In block receive mode, a message of an Rx port holds up to IOEN_A429_BLOCK_WORDS words
+ *   The configured labels of each port are marked in its presence bitmap, their control data
+ *   is stored densely in ioen_a429LabelCtrl
  *
  * INTERFACE:
  *   Global Data      :  ioen_a429MsgControl
+ *   Global Data      :  ioen_a429LabelCtrl
+ *   Global Data      :  ioen_a429Read
  *   Global Data      :  ioen_inMsgBuffer
  *
  *   In:      iom_p         : pointer to IOM configuration
@@ -46,6 +51,11 @@ void ioen_createPortsA429 (
  /*   UInt32_t                   portIdx;*/
     UInt32_t                   tableIdx;
     UInt32_t                   labelIdx;
+    UInt32_t                   portIdx;
+    UInt32_t                   word;
+    UInt32_t                   bit;
+    UInt32_t                   nofLabels;
+    A429MessageCtrlData_t     *labelCtrl_p;
     RETURN_CODE_TYPE           ret;
 /*    Char_t                    *portname;*/
     A429PortInfo_t            *portInfo_p;       /* pointer to port info in config             */
@@ -54,6 +64,7 @@ void ioen_createPortsA429 (
     /* Initialise runtime data */
     /* Reset runtime data      */
     memset (&ioen_a429MsgControl, 0, sizeof(ioen_a429MsgControl));
+    ioen_frInitWheel (&ioen_a429Freshness, ioen_a429Deadline, ioen_a429FreshEvent, IOEN_INC_MAX_A429_MESSAGES);
     ioen_429ConfigRoutingTable_p = iomA429RtTbl_p;
     /* Get First Port in config */
     portInfo_p = (A429PortInfo_t *)((void *)(iom_p) + iom_p->a429InputPortStart);
@@ -67,7 +78,7 @@ void ioen_createPortsA429 (
     	                /* CAN bus input for bus A for this partition */
     	                CREATE_QUEUING_PORT(
     	                	iomA429Port->portName,
-    	                    4,                    /* message length */
+    	                    (ioen_a429Read.block == TRUE) ? (IOEN_A429_BLOCK_WORDS * 4) : 4,   /* message length */
     	                    iomA429Port->queueLength,
     	                    DESTINATION,
     	                    FIFO,
@@ -82,7 +93,7 @@ void ioen_createPortsA429 (
     	 case IOEN_CAN_PORT_TYPE_ROUTING_TX:
     		 CREATE_QUEUING_PORT(
     				              iomA429Port->portName,
-    		    	              4,     /* message length */
+    		    	              (ioen_a429Fwd.batch == TRUE) ? (IOEN_A429_BLOCK_WORDS * 4) : 4,     /* message length */
     		    	              iomA429Port->queueLength,
     		    	              SOURCE,
     		    	              FIFO,
@@ -106,19 +117,99 @@ void ioen_createPortsA429 (
     }
     
   
+    /* Destination of the forwarded words of each input port, input ports with the same destination share it */
+    ioen_a429Fwd.nofDest = 0;
+    for (portIdx = 0; portIdx < IOEN_A429_MAX_PORTS; portIdx++)
+    {
+        ioen_a429Fwd.destSlot[portIdx] = IOEN_A429_FWD_NONE;
+        ioen_a429Fwd.nofWords[portIdx] = 0;
+
+        if (    (portIdx < iom_p->a429InputPortCount)
+            AND (portIdx < tableIdx)
+            AND (iomA429RtTbl_p[portIdx].transport_portindex != -1)
+           )
+        {
+            for (word = 0; word < ioen_a429Fwd.nofDest; word++)
+            {
+                if (ioen_a429Fwd.destTblIdx[word] == (UInt32_t)iomA429RtTbl_p[portIdx].transport_portindex)
+                {
+                    ioen_a429Fwd.destSlot[portIdx] = word;
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+            }
+
+            if (ioen_a429Fwd.destSlot[portIdx] == IOEN_A429_FWD_NONE)
+            {
+                ioen_a429Fwd.destSlot[portIdx]                   = ioen_a429Fwd.nofDest;
+                ioen_a429Fwd.destTblIdx[ioen_a429Fwd.nofDest]    = (UInt32_t)iomA429RtTbl_p[portIdx].transport_portindex;
+                ioen_a429Fwd.nofDest++;
+            }
+            else
+            {
+                /* No action as designed, destination already in use */
+            }
+        }
+        else
+        {
+            /* No action as designed, port not forwarded */
+        }
+    }
+
     /* Get First message in config */
     msgInfo_p = (A429MessageInfo_t *)((void *)(iom_p) + iom_p->a429InputMessageStart);
 
+    /* Mark the configured labels of each port */
+    for (labelIdx = 0; (labelIdx < iom_p->a429InputMessageCount); labelIdx++)
+    {
+        if (msgInfo_p->port < IOEN_A429_MAX_PORTS)
+        {
+            bit = (msgInfo_p->code * IOEN_A429_MAX_SDI) + msgInfo_p->sdi;
+            ioen_a429MsgControl[msgInfo_p->port].present[bit BIT_RSHIFT 5] = ioen_a429MsgControl[msgInfo_p->port].present[bit BIT_RSHIFT 5]
+                                                                             BIT_OR (1U BIT_LSHIFT (bit BIT_AND 31));
+        }
+        else
+        {
+            /* No action as designed, robustness against an invalid port */
+        }
+
+        msgInfo_p = (void *)msgInfo_p + sizeof(A429MessageInfo_t);
+    }
+
+    /* The labels of the ports are stored one port after the other, in the order of their bits */
+    nofLabels = 0;
+    for (portIdx = 0; portIdx < IOEN_A429_MAX_PORTS; portIdx++)
+    {
+        ioen_a429MsgControl[portIdx].first = nofLabels;
+
+        for (word = 0; word < IOEN_A429_LABEL_BITMAP_WORDS; word++)
+        {
+            ioen_a429MsgControl[portIdx].rankBase[word] = (UInt16_t)(nofLabels - ioen_a429MsgControl[portIdx].first);
+            nofLabels += ioen_UtilPopCount (ioen_a429MsgControl[portIdx].present[word]);
+        }
+    }
+
     /* create lookup table for quick access to configuration */
+    msgInfo_p = (A429MessageInfo_t *)((void *)(iom_p) + iom_p->a429InputMessageStart);
+
     for (labelIdx = 0; (labelIdx < iom_p->a429InputMessageCount); labelIdx++)
     {
-        ioen_a429MsgControl[msgInfo_p->port].data[msgInfo_p->code][msgInfo_p->sdi].msgInfo_p = msgInfo_p;
+        labelCtrl_p = ioen_im4FindLabel (msgInfo_p->port, msgInfo_p->code, msgInfo_p->sdi);
+
+        if (labelCtrl_p != NULL_PTR)
+        {
+            labelCtrl_p->msgInfo_p = msgInfo_p;
+            labelCtrl_p->labelIdx  = labelIdx;
+        }
+        else
+        {
+            /* No action as designed */
+        }
 
-        /* Initialise freshness counters */
-        ioen_ConfirmInitMsg (msgInfo_p->validTime,
-                             msgInfo_p->invalidTime,
-                             appPeriodMs,
-                             &ioen_a429MsgControl[msgInfo_p->port].data[msgInfo_p->code][msgInfo_p->sdi].ctrl);
+        /* Initialise freshness deadline */
+        ioen_frInitEntry (&ioen_a429Freshness, labelIdx, msgInfo_p->invalidTime, appPeriodMs);
 
         /* Increment pointer to next label */
         msgInfo_p = (void *)msgInfo_p + sizeof(A429MessageInfo_t);
@@ -133,12 +224,13 @@ void ioen_createPortsA429 (
  *   ioen_updateMessageFreshness
  *
  * DESCRIPTION:
- *   This function updates the freshness of all labels
+ *   This function updates the freshness of the labels received or due this cycle,
+ *   the other labels are not touched
  *
  * INTERFACE:
  *   Global Data      :  ioen_iomConfig_p
  *   Global Data      :  ioen_inMsgBuffer
- *   Global Data      :  ioen_a429MsgControl
+ *   Global Data      :  ioen_a429Freshness
  *
  *
  ******************************************************************/
@@ -146,96 +238,525 @@ void ioen_updateMessageFreshness (
     /*        */ void
 )
 {
+    UInt32_t               evIdx;
     UInt32_t               labelIdx;
+    A429MessageInfo_t     *msgFirst_p;      /* pointer to first A429 Label config */
     A429MessageInfo_t     *msgInfo_p;       /* pointer to A429 Label config   */
     A429PortInfo_t        *portInfo_p;      /* pointer to A429 port config    */
-    A429MessageCtrlData_t *msgCtrl_p;       /* pointer to A429 runtime data   */
+    A429RawData_t         *rawData_p;       /* pointer to A429 label data     */
     A429MessageData_t     *dataStart_p;     /* pointer to A429 message buffer */
 
     /* Get First message in config */
-    msgInfo_p     = (A429MessageInfo_t *) ((void *)(ioen_iomConfig_p) + ioen_iomConfig_p->a429InputMessageStart);
+    msgFirst_p    = (A429MessageInfo_t *) ((void *)(ioen_iomConfig_p) + ioen_iomConfig_p->a429InputMessageStart);
     portInfo_p    = (A429PortInfo_t *)    ((void *)(ioen_iomConfig_p) + ioen_iomConfig_p->a429InputPortStart);
-    dataStart_p   = (A429MessageData_t *) ((void *)(ioen_inMsgBuffer + portInfo_p->messageOffset));
 
-    /* Update freshness of all configured A429 labels */
-    for (labelIdx = 0; (labelIdx < ioen_iomConfig_p->a429InputMessageCount); labelIdx++)
+    /* Only the labels received or due this cycle change their freshness */
+    ioen_frUpdate (&ioen_a429Freshness);
+
+    for (evIdx = 0; evIdx < ioen_a429Freshness.nofEvents; evIdx++)
     {
-        msgCtrl_p = &ioen_a429MsgControl[msgInfo_p->port].data[msgInfo_p->code][msgInfo_p->sdi];
+        labelIdx  = ioen_a429Freshness.event_p[evIdx];
+        msgInfo_p = (A429MessageInfo_t *) ((void *)msgFirst_p + (labelIdx * sizeof (A429MessageInfo_t)));
+
+        /* Message buffer of the port of the label */
+        dataStart_p = (A429MessageData_t *) ((void *)(ioen_inMsgBuffer + portInfo_p[msgInfo_p->port].messageOffset));
+        rawData_p   = &dataStart_p[msgInfo_p->code].data[msgInfo_p->sdi];
 
-        if (msgCtrl_p->msgInfo_p != 0)
+        if (ioen_frIsExpired (&ioen_a429Freshness, labelIdx) == TRUE)
         {
-            /* Label config valid */
-            /* Check freshness */
-            ioen_ConfirmMsgFreshness (&msgCtrl_p->ctrl, &dataStart_p[msgInfo_p->code].data[msgInfo_p->sdi].freshness);
+            rawData_p->freshness = IOEN_MSG_UNFRESH;  /* Confirmed unfresh label */
         }
         else
         {
-            /* No action as designed, robustness against an invalid label */
+            rawData_p->freshness = IOEN_MSG_FRESH;    /* Confirmed valid label   */
         }
 
-        /* Increment pointer to next label */
-        msgInfo_p = (void *)msgInfo_p + sizeof (A429MessageInfo_t);
+        /* Label received or unfresh, process the datasets using it */
+        ioen_incMarkMessage (IOEN_TRANSPORT_A429, labelIdx);
     }
 
+    ioen_frClearEvents (&ioen_a429Freshness);
+
 }
 
 
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_readMessagesA429
+ *   ioen_a429FlushForward
  *
  * DESCRIPTION:
- *   This function reads messages from IO and process the data
+ *   This function sends the words collected for one destination port, and empties the buffer.
+ *   In batch mode a send holds up to IOEN_A429_BLOCK_WORDS words, otherwise one word.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Fwd
+ *   Global Data      :  ioen_429ConfigRoutingTable_p
+ *
+ *   In:  slot       : Destination
+ *
+ ******************************************************************/
+static void ioen_a429FlushForward (
+    /* IN     */ const UInt32_t                    slot
+)
+{
+    UInt32_t             sent;
+    UInt32_t             nofWords;
+    UInt32_t             maxWords;
+    RETURN_CODE_TYPE     ret;
+
+    maxWords = (ioen_a429Fwd.batch == TRUE) ? IOEN_A429_BLOCK_WORDS : 1;
+    sent     = 0;
+
+    while (sent < ioen_a429Fwd.nofWords[slot])
+    {
+        nofWords = ioen_a429Fwd.nofWords[slot] - sent;
+
+        if (nofWords > maxWords)
+        {
+            nofWords = maxWords;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+
+        SEND_QUEUING_MESSAGE(ioen_429ConfigRoutingTable_p[ioen_a429Fwd.destTblIdx[slot]].apexA429portId,
+                             (MESSAGE_ADDR_TYPE) &ioen_a429Fwd.words[slot][sent],
+                             (MESSAGE_SIZE_TYPE)(nofWords * 4),
+                             0,
+                             &ret);
+        CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
+
+        sent += nofWords;
+    }
+
+    ioen_a429Fwd.nofWords[slot] = 0;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_a429HandleWord
+ *
+ * DESCRIPTION:
+ *   This function processes one received A429 word, and collects it for forwarding if the port is routed
+ *   and the label passes the filter of the port
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Fwd
+ *
+ *   In:  portIdx    : Index of the port the word was received on
+ *   In:  a429Label  : Raw data of the A429 word
+ *
+ ******************************************************************/
+static void ioen_a429HandleWord (
+    /* IN     */ const UInt32_t                    portIdx,
+    /* IN     */ const UInt32_t                    a429Label
+)
+{
+    UInt32_t             a429word;
+    UInt32_t             bit;
+    UInt32_t             slot;
+
+    ioen_im4ProcessA429Message (portIdx, a429Label);
+
+    slot = ioen_a429Fwd.destSlot[portIdx];
+
+    if (slot != IOEN_A429_FWD_NONE)
+    {
+        /* Label and SDI of the word, for the filter of the port */
+        a429word = NTOH32(a429Label);
+        bit      = (ioen_im4GetA429Label (a429word) * IOEN_A429_MAX_SDI) + ioen_im4GetA429Sdi (a429word);
+
+        if (    (ioen_a429Fwd.filtered[portIdx] == FALSE)
+            OR ((ioen_a429Fwd.allow[portIdx][bit BIT_RSHIFT 5] BIT_AND (1U BIT_LSHIFT (bit BIT_AND 31))) != 0)
+           )
+        {
+            if (ioen_a429Fwd.nofWords[slot] >= IOEN_A429_FWD_MAX_WORDS)
+            {
+                /* Buffer full, send the collected words first */
+                ioen_a429FlushForward (slot);
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            ioen_a429Fwd.words[slot][ioen_a429Fwd.nofWords[slot]] = a429Label;
+            ioen_a429Fwd.nofWords[slot]++;
+        }
+        else
+        {
+            /* No action as designed, label not forwarded */
+        }
+    }
+    else
+    {
+        /* No action as designed, port not routed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_a429ReadBlocks
+ *
+ * DESCRIPTION:
+ *   This function reads the A429 words of one port in block receive mode.
+ *   Each read returns pending words of the port, up to IOEN_A429_BLOCK_WORDS, the words are
+ *   processed one by one as if they were read separately. The port is read until it is empty,
+ *   at most IOEN_A429_MAX_BLOCK_READS times per cycle, as the driver may return fewer words than pending
+ *   (one word per message).
  *
  * INTERFACE:
- *   Global Data      :  ioen_inMsgBuffer
- *   Global Data      :  ioen_iomConfig_p
  *   Global Data      :  ioen_a429MsgControl
+ *   Global Data      :  ioen_a429Read
+ *
+ *   In:  portIdx    : Index of the port
  *
  ******************************************************************/
-void ioen_readMessagesA429 (
-    /*        */ void
+static void ioen_a429ReadBlocks (
+    /* IN     */ const UInt32_t                    portIdx
 )
 {
-    UInt32_t             a429Label;
     UInt32_t             idx;
-    UInt32_t             portIdx;
+    UInt32_t             nofWords;
+    UInt32_t             nofReads;
+    Bool_t               readMore;
     RETURN_CODE_TYPE     ret;
     MESSAGE_SIZE_TYPE    len;
+    UInt32_t             a429Words[IOEN_A429_BLOCK_WORDS];
+    A429PortStatistics_t *stats_p;
 
-    for (portIdx = 0; (portIdx < ioen_iomConfig_p->a429InputPortCount); portIdx++)
+    stats_p  = &ioen_a429Read.stats[portIdx];
+    nofReads = 0;
+
+    do
     {
-        for (idx = 0; (idx < IOEN_A429_READS_PER_PORT_PER_CYCLE); idx++)
+        /* Read all A429 words received on this port (channel) */
+        RECEIVE_QUEUING_MESSAGE (ioen_a429MsgControl[portIdx].apexPortId,
+                                 (SYSTEM_TIME_TYPE)0,
+                                 (MESSAGE_ADDR_TYPE) &a429Words[0],
+                                 &len,
+                                 &ret
+                                );
+        nofReads++;
+
+        if (    (len >= 4)
+            AND ((ret == NO_ERROR) OR (ret == INVALID_CONFIG))
+           )
         {
-            /* Read a A429 word received on this port (channel) */
-            RECEIVE_QUEUING_MESSAGE (ioen_a429MsgControl[portIdx].apexPortId,
-                                     (SYSTEM_TIME_TYPE)0,
-                                     (MESSAGE_ADDR_TYPE) &a429Label,
-                                     &len,
-                                     &ret
-                                    );
+            /* NB: INVALID_CONFIG means the input queue is full, but we still received a message */
+            nofWords        = (UInt32_t)len / 4;
+            stats_p->words += nofWords;
 
-            if (    (len == 4)
-                AND ((ret == NO_ERROR) OR (ret == INVALID_CONFIG))
-               )
+            if (ret == INVALID_CONFIG)
             {
-                /* A429 word received, process A429 word                                             */
-                /* NB: INVALID_CONFIG means the input queue is full, but we still received a message */
-                ioen_im4ProcessA429Message (portIdx, a429Label);
-                if(ioen_429ConfigRoutingTable_p[portIdx].transport_portindex != -1)
-                {
-                	SEND_QUEUING_MESSAGE(ioen_429ConfigRoutingTable_p[ioen_429ConfigRoutingTable_p[portIdx].transport_portindex].apexA429portId, (MESSAGE_ADDR_TYPE) &a429Label, 4, 0, &ret);
-                 	CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
-                }
+                stats_p->overflows++;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            for (idx = 0; idx < nofWords; idx++)
+            {
+                ioen_a429HandleWord (portIdx, a429Words[idx]);
+            }
+
+            /* Words may be pending, read until the port is empty */
+            if (nofReads >= IOEN_A429_MAX_BLOCK_READS)
+            {
+                stats_p->budgetStops++;
+                readMore = FALSE;
+            }
+            else
+            {
+                readMore = TRUE;
+            }
+        }
+        else
+        {
+            /* Port empty */
+            stats_p->emptyReads++;
+            readMore = FALSE;
+        }
+    } while (readMore == TRUE);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_a429ReadWords
+ *
+ * DESCRIPTION:
+ *   This function reads single A429 words from one port, until the port is empty or maxReads words were read.
+ *   The words, empty reads, overflows and budget stops are counted, and the reads needed in this cycle
+ *   are recorded for the adaptive budget: the words read plus the empty read, or 1.5 times the budget
+ *   when the budget was used up, as more words may be pending.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429MsgControl
+ *   Global Data      :  ioen_a429Read
+ *
+ *   In:  portIdx    : Index of the port
+ *   In:  maxReads   : Maximum number of reads
+ *
+ ******************************************************************/
+static void ioen_a429ReadWords (
+    /* IN     */ const UInt32_t                    portIdx,
+    /* IN     */ const UInt32_t                    maxReads
+)
+{
+    UInt32_t               a429Label;
+    UInt32_t               nofReads;
+    UInt32_t               nofWords;
+    Bool_t                 readMore;
+    RETURN_CODE_TYPE       ret;
+    MESSAGE_SIZE_TYPE      len;
+    A429PortStatistics_t  *stats_p;
+
+    stats_p  = &ioen_a429Read.stats[portIdx];
+    nofReads = 0;
+    nofWords = 0;
+    readMore = (maxReads > 0);
+
+    while (readMore == TRUE)
+    {
+        /* Read a A429 word received on this port (channel) */
+        RECEIVE_QUEUING_MESSAGE (ioen_a429MsgControl[portIdx].apexPortId,
+                                 (SYSTEM_TIME_TYPE)0,
+                                 (MESSAGE_ADDR_TYPE) &a429Label,
+                                 &len,
+                                 &ret
+                                );
+        nofReads++;
+
+        if (    (len == 4)
+            AND ((ret == NO_ERROR) OR (ret == INVALID_CONFIG))
+           )
+        {
+            /* A429 word received, process A429 word                                             */
+            /* NB: INVALID_CONFIG means the input queue is full, but we still received a message */
+            ioen_a429HandleWord (portIdx, a429Label);
+            nofWords++;
+
+            if (ret == INVALID_CONFIG)
+            {
+                stats_p->overflows++;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            if (nofReads >= maxReads)
+            {
+                /* Budget used up, words may still be queued */
+                stats_p->budgetStops++;
+                readMore = FALSE;
             }
             else
             {
                 /* No action as designed */
             }
-            
         }
+        else
+        {
+            /* Port empty */
+            stats_p->emptyReads++;
+            readMore = FALSE;
+        }
+    }
 
+    stats_p->words += nofWords;
+
+    if (nofWords >= maxReads)
+    {
+        ioen_a429Read.need[portIdx] = maxReads + (maxReads / 2) + 1;
+    }
+    else
+    {
+        ioen_a429Read.need[portIdx] = nofWords + 1;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_a429AdaptBudget
+ *
+ * DESCRIPTION:
+ *   This function moves the single word read budget of the ports toward the busy ports.
+ *   The reads needed per port are smoothed over about 4 cycles, and limited to
+ *   IOEN_A429_MIN_READS_PER_PORT..IOEN_A429_MAX_READS_PER_PORT. While the ports together need at most
+ *   IOEN_A429_READ_BUDGET_CAP reads, the unused reads of the cap lift the quiet ports up to
+ *   IOEN_A429_READS_PER_PORT_PER_CYCLE, so a burst on a quiet port is read as with the fixed budget.
+ *   If the ports need more, each port keeps its minimum and the rest of the cap is shared
+ *   in proportion to the need above the minimum.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_iomConfig_p
+ *   Global Data      :  ioen_a429Read
+ *
+ ******************************************************************/
+static void ioen_a429AdaptBudget (
+    /*        */ void
+)
+{
+    UInt32_t             portIdx;
+    UInt32_t             nofPorts;
+    UInt32_t             want[IOEN_A429_MAX_PORTS];
+    UInt32_t             total;
+    UInt32_t             sumExtra;
+    UInt32_t             spare;
+    UInt32_t             raise;
+    A429ReadCtrl_t      *ctrl_p;
+
+    ctrl_p   = &ioen_a429Read;
+    nofPorts = ioen_iomConfig_p->a429InputPortCount;
+    total    = 0;
+    sumExtra = 0;
+
+    for (portIdx = 0; portIdx < nofPorts; portIdx++)
+    {
+        /* Exponential average, demand converges to 16 x need */
+        ctrl_p->demand[portIdx] = (ctrl_p->demand[portIdx] - (ctrl_p->demand[portIdx] BIT_RSHIFT 2)) + (ctrl_p->need[portIdx] BIT_LSHIFT 2);
+
+        want[portIdx] = (ctrl_p->demand[portIdx] + 15) BIT_RSHIFT 4;
+
+        if (want[portIdx] < IOEN_A429_MIN_READS_PER_PORT)
+        {
+            want[portIdx] = IOEN_A429_MIN_READS_PER_PORT;
+        }
+        else if (want[portIdx] > IOEN_A429_MAX_READS_PER_PORT)
+        {
+            want[portIdx] = IOEN_A429_MAX_READS_PER_PORT;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+
+        total    += want[portIdx];
+        sumExtra += want[portIdx] - IOEN_A429_MIN_READS_PER_PORT;
+    }
+
+    if (total > IOEN_A429_READ_BUDGET_CAP)
+    {
+        spare = 0;
+    }
+    else
+    {
+        spare = IOEN_A429_READ_BUDGET_CAP - total;
+    }
+
+    for (portIdx = 0; portIdx < nofPorts; portIdx++)
+    {
+        if (total > IOEN_A429_READ_BUDGET_CAP)
+        {
+            /* Share the cap, sumExtra > 0 as the minimums fit in the cap */
+            ctrl_p->budget[portIdx] = IOEN_A429_MIN_READS_PER_PORT
+                                    + (((want[portIdx] - IOEN_A429_MIN_READS_PER_PORT)
+                                        * (IOEN_A429_READ_BUDGET_CAP - (nofPorts * IOEN_A429_MIN_READS_PER_PORT))) / sumExtra);
+        }
+        else if (want[portIdx] < IOEN_A429_READS_PER_PORT_PER_CYCLE)
+        {
+            /* Quiet port, keeps up to the fixed budget from the reads not used by the other ports */
+            raise = IOEN_A429_READS_PER_PORT_PER_CYCLE - want[portIdx];
+
+            if (raise > spare)
+            {
+                raise = spare;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            spare                  -= raise;
+            ctrl_p->budget[portIdx] = want[portIdx] + raise;
+        }
+        else
+        {
+            ctrl_p->budget[portIdx] = want[portIdx];
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_readMessagesA429
+ *
+ * DESCRIPTION:
+ *   This function reads messages from IO and process the data
+ *   Single words are read per port until the port is empty, up to IOEN_A429_READS_PER_PORT_PER_CYCLE
+ *   or the adaptive budget of the port, or in block receive mode all pending words of the port (see ioen_a429ReadBlocks)
+ *   The words forwarded to other partitions are sent after all ports were read
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inMsgBuffer
+ *   Global Data      :  ioen_iomConfig_p
+ *   Global Data      :  ioen_a429MsgControl
+ *   Global Data      :  ioen_a429Read
+ *   Global Data      :  ioen_a429Fwd
+ *   Global Data      :  ioen_a429Rate
+ *
+ ******************************************************************/
+void ioen_readMessagesA429 (
+    /*        */ void
+)
+{
+    UInt32_t             portIdx;
+    RETURN_CODE_TYPE     ret;
+
+    for (portIdx = 0; (portIdx < ioen_iomConfig_p->a429InputPortCount); portIdx++)
+    {
+        if (ioen_a429Rate.enabled == TRUE)
+        {
+            /* Arrival time of the words of this read */
+            GET_TIME (&ioen_a429Rate.now, &ret);
+        }
+        else
+        {
+            /* No action as designed */
+        }
+
+        if (ioen_a429Read.block == TRUE)
+        {
+            ioen_a429ReadBlocks (portIdx);
+        }
+        else if (ioen_a429Read.adaptive == TRUE)
+        {
+            ioen_a429ReadWords (portIdx, ioen_a429Read.budget[portIdx]);
+        }
+        else
+        {
+            ioen_a429ReadWords (portIdx, IOEN_A429_READS_PER_PORT_PER_CYCLE);
+        }
+    }
+
+    if ((ioen_a429Read.adaptive == TRUE) AND (ioen_a429Read.block == FALSE))
+    {
+        /* Budget of the next cycle */
+        ioen_a429AdaptBudget ();
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    /* Send the forwarded words, one batch per destination */
+    for (portIdx = 0; portIdx < ioen_a429Fwd.nofDest; portIdx++)
+    {
+        ioen_a429FlushForward (portIdx);
     }
 
     /* Update freshness of all configured A429 messages (labels) */
@@ -245,3 +766,273 @@ void ioen_readMessagesA429 (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setA429BlockReceive
+ *
+ * DESCRIPTION:
+ *   This function switches the block receive mode of the A429 input ports on or off.
+ *   The mode sets the message size of the ports, it must be set before ioen_createPorts.
+ *   The A429 driver must deliver the pending words of a channel as one message.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Read
+ *
+ *   In:  enable      : TRUE = read all pending words per read, FALSE = one word per read
+ *
+ ******************************************************************/
+void ioen_setA429BlockReceive (
+   /* IN     */ const Bool_t                 enable
+)
+{
+    ioen_a429Read.block = enable;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setA429AdaptiveBudget
+ *
+ * DESCRIPTION:
+ *   This function switches the adaptive read budget of the A429 input ports on or off.
+ *   Each port starts with IOEN_A429_READS_PER_PORT_PER_CYCLE reads, the budget then follows the
+ *   traffic of the port within IOEN_A429_READ_BUDGET_CAP reads of all ports per cycle.
+ *   The adaptive budget applies to single word reads, not to the block receive mode.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Read
+ *
+ *   In:  enable      : TRUE = adaptive budget, FALSE = IOEN_A429_READS_PER_PORT_PER_CYCLE reads per port
+ *
+ ******************************************************************/
+void ioen_setA429AdaptiveBudget (
+   /* IN     */ const Bool_t                 enable
+)
+{
+    UInt32_t             portIdx;
+
+    for (portIdx = 0; portIdx < IOEN_A429_MAX_PORTS; portIdx++)
+    {
+        ioen_a429Read.budget[portIdx] = IOEN_A429_READS_PER_PORT_PER_CYCLE;
+        ioen_a429Read.need[portIdx]   = IOEN_A429_READS_PER_PORT_PER_CYCLE;
+        ioen_a429Read.demand[portIdx] = IOEN_A429_READS_PER_PORT_PER_CYCLE BIT_LSHIFT 4;
+    }
+
+    ioen_a429Read.adaptive = enable;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_getA429PortStatistics
+ *
+ * DESCRIPTION:
+ *   This function returns the receive statistics of an A429 input port, and optionally clears them.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Read
+ *
+ *   In:   portIdx : Index of the port in the configuration
+ *   In:   clear   : TRUE = clear the statistics after reading
+ *   Out:  stats_p : Statistics of the port
+ *
+ ******************************************************************/
+void ioen_getA429PortStatistics (
+   /* IN     */ const UInt32_t                       portIdx,
+   /* IN     */ const Bool_t                         clear,
+   /*    OUT */       A429PortStatistics_t   * const stats_p
+)
+{
+    if (portIdx < IOEN_A429_MAX_PORTS)
+    {
+        *stats_p = ioen_a429Read.stats[portIdx];
+
+        if (ioen_a429Read.adaptive == TRUE)
+        {
+            stats_p->budget = ioen_a429Read.budget[portIdx];
+        }
+        else
+        {
+            stats_p->budget = IOEN_A429_READS_PER_PORT_PER_CYCLE;
+        }
+
+        if (clear == TRUE)
+        {
+            memset (&ioen_a429Read.stats[portIdx], 0, sizeof(A429PortStatistics_t));
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+    else
+    {
+        memset (stats_p, 0, sizeof(A429PortStatistics_t));
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setA429BatchForward
+ *
+ * DESCRIPTION:
+ *   This function switches the batch mode of the A429 forwarding on or off.
+ *   In batch mode the routing ports are created with a message size of IOEN_A429_BLOCK_WORDS words,
+ *   and a send holds up to IOEN_A429_BLOCK_WORDS words, the receiving partition must use block receive.
+ *   The mode must be set before ioen_createPorts.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Fwd
+ *
+ *   In:  enable      : TRUE = batch of words per send, FALSE = one word per send
+ *
+ ******************************************************************/
+void ioen_setA429BatchForward (
+   /* IN     */ const Bool_t                 enable
+)
+{
+    ioen_a429Fwd.batch = enable;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setA429ForwardFilter
+ *
+ * DESCRIPTION:
+ *   This function sets the labels forwarded from an A429 input port.
+ *   Bit (code * 4 + sdi) of the bitmap allows the label with this code and SDI,
+ *   without a bitmap all labels of the port are forwarded.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Fwd
+ *
+ *   In:  portIdx     : Index of the input port in the configuration
+ *   In:  allow_p     : Bitmap of IOEN_A429_LABEL_BITMAP_WORDS words, NULL = forward all labels
+ *
+ ******************************************************************/
+void ioen_setA429ForwardFilter (
+   /* IN     */ const UInt32_t                       portIdx,
+   /* IN     */ const UInt32_t               * const allow_p
+)
+{
+    if (portIdx < IOEN_A429_MAX_PORTS)
+    {
+        if (allow_p != NULL_PTR)
+        {
+            memcpy (ioen_a429Fwd.allow[portIdx], allow_p, sizeof(ioen_a429Fwd.allow[portIdx]));
+            ioen_a429Fwd.filtered[portIdx] = TRUE;
+        }
+        else
+        {
+            ioen_a429Fwd.filtered[portIdx] = FALSE;
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setA429RateMonitor
+ *
+ * DESCRIPTION:
+ *   This function switches the recording of the arrival time and update rate of the A429 labels on or off.
+ *   The arrival time is the time of the port read, one GET_TIME per port and cycle.
+ *   Switching on clears the statistics.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_a429Rate
+ *
+ *   In:  enable      : TRUE = record the arrivals
+ *
+ ******************************************************************/
+void ioen_setA429RateMonitor (
+   /* IN     */ const Bool_t                 enable
+)
+{
+    if ((enable == TRUE) AND (ioen_a429Rate.enabled == FALSE))
+    {
+        memset (ioen_a429Rate.label, 0, sizeof(ioen_a429Rate.label));
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    ioen_a429Rate.enabled = enable;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_getA429LabelStatistics
+ *
+ * DESCRIPTION:
+ *   This function returns the update rate of an A429 label, and optionally clears it.
+ *   The period and jitter are valid after two reads with the label.
+ *   A label that is not processed (invalid port, or a duplicate of a later label) has no statistics.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_iomConfig_p
+ *   Global Data      :  ioen_a429LabelCtrl
+ *   Global Data      :  ioen_a429Rate
+ *
+ *   In:   labelIdx : Index of the label in the configuration
+ *   In:   clear    : TRUE = clear the statistics after reading
+ *   Out:  stats_p  : Statistics of the label
+ *
+ ******************************************************************/
+void ioen_getA429LabelStatistics (
+   /* IN     */ const UInt32_t                       labelIdx,
+   /* IN     */ const Bool_t                         clear,
+   /*    OUT */       A429LabelStatistics_t  * const stats_p
+)
+{
+    UInt32_t                entryIdx;
+    A429MessageInfo_t      *msgInfo_p;       /* pointer to A429 Label config   */
+    A429MessageCtrlData_t  *labelCtrl_p;     /* pointer to A429 runtime data   */
+
+    labelCtrl_p = NULL_PTR;
+
+    if ((ioen_iomConfig_p != NULL_PTR) AND (labelIdx < ioen_iomConfig_p->a429InputMessageCount))
+    {
+        /* Entry of the label in ioen_a429LabelCtrl */
+        msgInfo_p   = (A429MessageInfo_t *) ((void *)(ioen_iomConfig_p) + ioen_iomConfig_p->a429InputMessageStart
+                                                                        + (labelIdx * sizeof (A429MessageInfo_t)));
+        labelCtrl_p = ioen_im4FindLabel (msgInfo_p->port, msgInfo_p->code, msgInfo_p->sdi);
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    if ((labelCtrl_p != NULL_PTR) AND (labelCtrl_p->labelIdx == labelIdx))
+    {
+        entryIdx = (UInt32_t)(labelCtrl_p - &ioen_a429LabelCtrl[0]);
+        *stats_p = ioen_a429Rate.label[entryIdx];
+
+        if (clear == TRUE)
+        {
+            memset (&ioen_a429Rate.label[entryIdx], 0, sizeof(A429LabelStatistics_t));
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+    else
+    {
+        memset (stats_p, 0, sizeof(A429LabelStatistics_t));
+    }
+}
@@ -275,6 +275,7 @@ void ioen_aaInitSignalConfirmation (
  * INTERFACE:
  *
  *   Global Data      :  ioen_afdxMsgCtrl
+ *   Global Data      :  ioen_afdxFreshness
  *   Global Data      :  ioen_imaMsgValidity
  *
  *   In:  iom_p       : pointer to IOM Configuration
@@ -293,6 +294,7 @@ void ioen_createRxPortsAfdx (
 
     /* Clear dynamic data */
     memset ((void *) &ioen_afdxMsgCtrl, 0x00, sizeof(ioen_afdxMsgCtrl));
+    ioen_frInitWheel (&ioen_afdxFreshness, ioen_afdxDeadline, ioen_afdxFreshEvent, IOEN_MAX_RX_PORT_NUMBER);
 
     msg_p = AFDX_INPUT_MSG_FIRST(iom_p);
 
@@ -349,18 +351,101 @@ void ioen_createRxPortsAfdx (
         }
 
         /* Calculate number of cycles for next out of date message, rounding up */
-        ioen_ConfirmInitMsg (msg_p->validTime,
-                             msg_p->invalidTime,
-                             appPeriodMs,
-                             &ioen_afdxMsgCtrl[idx].objCtrl);
-
-        /* Initialise the start cycle, to schedule reads for this message */
-        ioen_afdxMsgCtrl[idx].readCycle = msg_p->schedOffset;
+        ioen_frInitEntry (&ioen_afdxFreshness, idx, msg_p->invalidTime, appPeriodMs);
 
         msg_p++;
     }
 
+    /* Build the read schedule of the input ports */
+    ioen_aaInitReadSchedule (iom_p);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_aaScheduleRead
+ *
+ * DESCRIPTION:
+ *   This function inserts a queuing port into the slot of the read schedule wheel
+ *   that corresponds to the cycle of its next read.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  ioen_afdxMsgCtrl
+ *   Global Data      :  ioen_afdxReadSchedule
+ *
+ *   In:  idx         : index of the input message
+ *
+ ******************************************************************/
+static void ioen_aaScheduleRead (
+    /* IN     */ const UInt32_t                    idx
+)
+{
+    UInt32_t slot;
+
+    slot = ioen_afdxMsgCtrl[idx].readCycle % IOEN_AFDX_SCHED_WHEEL_SIZE;
 
+    ioen_afdxReadSchedule.next[idx]        = ioen_afdxReadSchedule.slotFirst[slot];
+    ioen_afdxReadSchedule.slotFirst[slot]  = (UInt16_t)idx;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_aaInitReadSchedule
+ *
+ * DESCRIPTION:
+ *   This function builds the read schedule of the AFDX input ports.
+ *   Sampling ports are read every cycle and are kept in a plain list.
+ *   Queuing ports are read in cycle schedOffset and then every schedRate cycles.
+ *   They are kept in a timing wheel, each slot holds the ports whose next read
+ *   falls in a cycle modulo IOEN_AFDX_SCHED_WHEEL_SIZE.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  ioen_afdxMsgCtrl
+ *   Global Data      :  ioen_afdxReadSchedule
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *
+ ******************************************************************/
+void ioen_aaInitReadSchedule (
+    /* IN     */ const IOMConfigHeader_t   * const iom_p
+)
+{
+    UInt32_t            idx;
+    UInt32_t            slot;
+    AfdxMessageInfo_t  *msg_p;
+
+    ioen_afdxReadSchedule.cycle       = 0;
+    ioen_afdxReadSchedule.nofSampling = 0;
+
+    for (slot = 0; slot < IOEN_AFDX_SCHED_WHEEL_SIZE; slot++)
+    {
+        ioen_afdxReadSchedule.slotFirst[slot] = IOEN_AFDX_SCHED_END;
+    }
+
+    msg_p = AFDX_INPUT_MSG_FIRST(iom_p);
+
+    for (idx = 0; idx < iom_p->afdxInputMessageCount; idx++)
+    {
+        if (msg_p->queueLength == 0)
+        {
+            /* Sampling port, read every cycle */
+            ioen_afdxReadSchedule.sampling[ioen_afdxReadSchedule.nofSampling] = (UInt16_t)idx;
+            ioen_afdxReadSchedule.nofSampling++;
+        }
+        else
+        {
+            /* Queuing port, the first read is in the start cycle */
+            ioen_afdxMsgCtrl[idx].readCycle = msg_p->schedOffset;
+            ioen_aaScheduleRead (idx);
+        }
+
+        msg_p++;
+    }
 }
 
 
@@ -495,19 +580,20 @@ void ioen_writeMessagesAfdx (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_processInputAfdxA429
+ *   ioen_aaWalkInputAfdxA429
  *
  * DESCRIPTION:
- *   This function processes one frame of input data:
+ *   This function processes one frame of input data by walking the configuration:
  *         Traverse all datasets and convert/copy signal from messages to parameters
  *         in the parameter buffer according to source selection and data conversion
+ *   In incremental mode unchanged datasets are skipped, see ioen_incSkipDataset.
  *
  * INTERFACE:
  *
  *   Global Data:   ioen_iomConfig_p
  *
  ******************************************************************/
-void ioen_processInputAfdxA429 (
+static void ioen_aaWalkInputAfdxA429 (
        /*        */       void
 )
 {
@@ -525,8 +611,16 @@ void ioen_processInputAfdxA429 (
     paramIdx = 0;
     for (idx = 0; (idx < iom_p->afdxInputDatasetCount); idx++)
     {
-        /* Process and route to application, all datasets with a single source */
-        ioen_imaProcessDataset(dataset_p, ioen_inObjectCtrl[paramIdx]);
+        if (ioen_incSkipDataset (paramIdx, dataset_p, TRUE, ioen_inObjectCtrl[paramIdx]) == FALSE)
+        {
+            /* Process and route to application, all datasets with a single source */
+            ioen_imaProcessDataset(dataset_p, ioen_inObjectCtrl[paramIdx]);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset unchanged since it was last processed  */
+        }
 
         /* Increment pointer to next dataset */
         dataset_p = (void *)dataset_p + dataset_p->datasetSize;
@@ -539,8 +633,16 @@ void ioen_processInputAfdxA429 (
     paramIdx = iom_p->afdxInputDatasetCount;
     for (idx = 0; (idx < iom_p->afdxInputDatasetMultiCount); idx++)
     {
-        /* Process and route to source buffer, all datasets wita multiple sources */
-        ioen_imaProcessDatasetSources (dataset_p, ioen_inObjectCtrl[paramIdx]);
+        if (ioen_incSkipDataset (paramIdx, dataset_p, FALSE, ioen_inObjectCtrl[paramIdx]) == FALSE)
+        {
+            /* Process and route to source buffer, all datasets wita multiple sources */
+            ioen_imaProcessDatasetSources (dataset_p, ioen_inObjectCtrl[paramIdx]);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset unchanged since it was last processed  */
+        }
 
         /* Increment pointer to next dataset */
         dataset_p = (void *)dataset_p + dataset_p->datasetSize;
@@ -559,8 +661,16 @@ void ioen_processInputAfdxA429 (
 
     for (idx = 0; (idx < iom_p->afdxInputDatasetMultiCount); idx++)
     {
-        /* Using the selected sources, route to application, all datasets with multiple sources */
-        ioen_imaProcessDatasetValue(iom_p, dataset_p, ioen_inObjectCtrl[paramIdx]);
+        if (ioen_incSkipDatasetValue (paramIdx, dataset_p) == FALSE)
+        {
+            /* Using the selected sources, route to application, all datasets with multiple sources */
+            ioen_imaProcessDatasetValue(iom_p, dataset_p, ioen_inObjectCtrl[paramIdx]);
+        }
+        else
+        {
+            /* No action as designed                                  */
+            /* Dataset unchanged and same source selected             */
+        }
 
         /* Increment pointer to next dataset */
         dataset_p = (void *)dataset_p + dataset_p->datasetSize;
@@ -571,6 +681,40 @@ void ioen_processInputAfdxA429 (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_processInputAfdxA429
+ *
+ * DESCRIPTION:
+ *   This function processes one frame of input data.
+ *   The precompiled execution plan is used when it is selected and valid (see ioen_epProcessInput),
+ *   otherwise the configuration is walked. Both produce the same results.
+ *
+ * INTERFACE:
+ *
+ *   Global Data:   ioen_inputExecPlan
+ *
+ ******************************************************************/
+void ioen_processInputAfdxA429 (
+       /*        */       void
+)
+{
+    if (    (ioen_inputExecPlan.enabled == TRUE)
+        AND (ioen_inputExecPlan.valid   == TRUE)
+       )
+    {
+        /* Execute the precompiled plan */
+        ioen_epProcessInput ();
+    }
+    else
+    {
+        /* Walk the configuration */
+        ioen_aaWalkInputAfdxA429 ();
+    }
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_aaNewMessageAfdx
@@ -580,6 +724,8 @@ void ioen_processInputAfdxA429 (
  *
  * INTERFACE:
  *
+ *   Global Data      :  ioen_afdxFreshness
+ *
  *   In    :  msginfo_p        : pointer to message config
  *   In    :  messageStart_p   : pointer to message data
  *   In Out:  msgCtrl_p        : pointer to message confirmation control objects
@@ -595,11 +741,10 @@ void ioen_aaNewMessageAfdx (
     Bool_t               fcOk;
 
     /* Check CRC */
-   /* crcOk = ioen_UtilCheckCrc (messageStart_p, msginfo_p);*/
+    crcOk = ioen_UtilCheckCrc (messageStart_p, msginfo_p);
 
     /* Check Freshness counter */
    /* fcOk = ioen_UtilCheckFc (messageStart_p, msginfo_p, &msgCtrl_p->fcCtrl);*/
-    crcOk = TRUE;
     fcOk  = TRUE;
     
     if (    (crcOk == TRUE)
@@ -607,7 +752,7 @@ void ioen_aaNewMessageAfdx (
        )
     {
         /* APEX message received and still valid */
-        ioen_ConfirmSetNewMsgData (&msgCtrl_p->objCtrl);
+        ioen_frNewData (&ioen_afdxFreshness, (UInt32_t)(msgCtrl_p - &ioen_afdxMsgCtrl[0]));
     }
     else
     {
@@ -618,16 +763,89 @@ void ioen_aaNewMessageAfdx (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_aaReadMessageAfdx
+ *
+ * DESCRIPTION:
+ *   This function reads one AFDX input port, and checks the message if one was received.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  ioen_inMsgBuffer
+ *
+ *   In    :  msginfo_p        : pointer to message config
+ *   In Out:  msgCtrl_p        : pointer to message confirmation control objects
+ *
+ ******************************************************************/
+static void ioen_aaReadMessageAfdx (
+    /* IN     */ const AfdxMessageInfo_t        * const msginfo_p,
+    /* IN OUT */       IomMessageCtrlData_t     * const msgCtrl_p
+)
+{
+    void                *messageStart_p;
+    MESSAGE_SIZE_TYPE    len;
+    RETURN_CODE_TYPE     ret;
+    VALIDITY_TYPE        validity;
+
+    messageStart_p = ioen_inMsgBuffer + msginfo_p->messageHdrOffset + sizeof(AfdxMessageHeader_t);
+
+    if (msginfo_p->queueLength == 0)
+    {
+        /* Sampling message configured, use APEX interface to read it */
+        READ_SAMPLING_MESSAGE(msgCtrl_p->apexPortId, messageStart_p, &len, &validity, &ret);
+
+        if (    (ret      == NO_ERROR)
+            AND (validity == VALID   )
+           )
+        {
+            /* Extra checks if the message is valid */
+            ioen_aaNewMessageAfdx (msginfo_p, messageStart_p, msgCtrl_p);
+        }
+        else
+        {
+            /* No message received this cycle */
+            /* No action as designed          */
+        }
+    }
+    else
+    {
+        RECEIVE_QUEUING_MESSAGE (msgCtrl_p->apexPortId, (SYSTEM_TIME_TYPE)0, messageStart_p, &len, &ret);
+
+        if (     (len > 0)
+             AND ((ret == NO_ERROR) OR (ret == INVALID_CONFIG))
+           )
+        {
+            /* NB: INVALID_CONFIG means a message was received,                   */
+            /* but a further message was lost because the queue size is too small */
+
+            /* Extra checks if the message is valid */
+            ioen_aaNewMessageAfdx (msginfo_p, messageStart_p, msgCtrl_p);
+        }
+        else
+        {
+            /* No message received this cycle */
+            /* No action as designed          */
+        }
+    }
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_readMessagesAfdx
  *
  * DESCRIPTION:
  *   This function reads the AFDX input ports as defined in the IOM configuration.
+ *   Only the sampling ports and the queuing ports scheduled for this cycle are read,
+ *   see ioen_aaInitReadSchedule.
  *
  * INTERFACE:
  *
  *   Global Data      :  ioen_afdxMsgCtrl
+ *   Global Data      :  ioen_afdxReadSchedule
+ *   Global Data      :  ioen_afdxFreshness
  *   Global Data      :  ioen_iomConfig_p
  *   Global Data      :  ioen_inMsgBuffer
  *
@@ -636,88 +854,90 @@ void ioen_readMessagesAfdx (
    /*        */       void
 )
 {
+    UInt32_t             i;
     UInt32_t             idx;             /* index of read message                                     */
+    UInt32_t             nextIdx;         /* index of next message in the same slot                    */
+    UInt32_t             slot;            /* slot of the schedule wheel for this cycle                 */
+    AfdxMessageInfo_t   *msgFirst_p;      /* pointer to first message info structure                   */
     AfdxMessageInfo_t   *msginfo_p;       /* pointer to processed corresponding message info structure */
-    void                *messageStart_p;
     AfdxMessageHeader_t *msgHdr_p;
-    MESSAGE_SIZE_TYPE    len;
-    RETURN_CODE_TYPE     ret;
-    VALIDITY_TYPE        validity;
 
+    msgFirst_p = AFDX_INPUT_MSG_FIRST(ioen_iomConfig_p);
+
+    /* Sampling ports are read every cycle */
+    for (i = 0; i < ioen_afdxReadSchedule.nofSampling; i++)
+    {
+        idx = ioen_afdxReadSchedule.sampling[i];
+
+        ioen_aaReadMessageAfdx (&msgFirst_p[idx], &ioen_afdxMsgCtrl[idx]);
+
+        /* Keep the signal words in host byte order, if selected */
+        ioen_epCanonicalizeMessage (idx);
+    }
 
-    msginfo_p = AFDX_INPUT_MSG_FIRST(ioen_iomConfig_p);
+    /* Take the queuing ports of this slot from the wheel, they are inserted again below */
+    slot = ioen_afdxReadSchedule.cycle % IOEN_AFDX_SCHED_WHEEL_SIZE;
+    idx  = ioen_afdxReadSchedule.slotFirst[slot];
+    ioen_afdxReadSchedule.slotFirst[slot] = IOEN_AFDX_SCHED_END;
 
-    for (idx = 0;
-         idx < ioen_iomConfig_p->afdxInputMessageCount;
-         idx++)
+    while (idx != IOEN_AFDX_SCHED_END)
     {
-        msgHdr_p       = (AfdxMessageHeader_t *)(ioen_inMsgBuffer + msginfo_p->messageHdrOffset);
-        messageStart_p = ioen_inMsgBuffer + msginfo_p->messageHdrOffset + sizeof(AfdxMessageHeader_t);
+        nextIdx   = ioen_afdxReadSchedule.next[idx];
+        msginfo_p = &msgFirst_p[idx];
 
-        /* Check if message is scheduled to be read this cycle */
-	
-	  if (msginfo_p->queueLength == 0)
-            {
-			  
-                /* Sampling message configured, use APEX interface to read it */
-                READ_SAMPLING_MESSAGE(ioen_afdxMsgCtrl[idx].apexPortId, messageStart_p, &len, &validity, &ret);
+        if (ioen_afdxMsgCtrl[idx].readCycle == ioen_afdxReadSchedule.cycle)
+        {
+            /* Message is scheduled to be read this cycle */
+            ioen_aaReadMessageAfdx (msginfo_p, &ioen_afdxMsgCtrl[idx]);
 
-                if (    (ret      == NO_ERROR)
-                    AND (validity == VALID   )
-                   )
-                {
-                    /* Extra checks if the message is valid */
-                    ioen_aaNewMessageAfdx (msginfo_p, messageStart_p, &ioen_afdxMsgCtrl[idx]);
-                }
-                else
-                {
-                    /* No message received this cycle */
-                    /* No action as designed          */
-                }
+            /* Keep the signal words in host byte order, if selected */
+            ioen_epCanonicalizeMessage (idx);
+
+            /* Schedule the next read, a rate of 0 is handled as every cycle */
+            if (msginfo_p->schedRate > 1)
+            {
+                ioen_afdxMsgCtrl[idx].readCycle += msginfo_p->schedRate;
             }
-		else{
-		     if (ioen_afdxMsgCtrl[idx].readCycle == 0)
-			 {
-			  RECEIVE_QUEUING_MESSAGE (ioen_afdxMsgCtrl[idx].apexPortId, (SYSTEM_TIME_TYPE)0, messageStart_p, &len, &ret);
-
-                if (     (len > 0)
-                     AND ((ret == NO_ERROR) OR (ret == INVALID_CONFIG))
-                   )
-                {
-                    /* NB: INVALID_CONFIG means a message was received,                   */ 
-                    /* but a further message was lost because the queue size is too small */
+            else
+            {
+                ioen_afdxMsgCtrl[idx].readCycle++;
+            }
+        }
+        else
+        {
+            /* No action as designed                 */
+            /* Due in a later turn of the wheel      */
+        }
 
-                    /* Extra checks if the message is valid */
-                    ioen_aaNewMessageAfdx (msginfo_p, messageStart_p, &ioen_afdxMsgCtrl[idx]);
-                }
-                else
-                {
-                    /* No message received this cycle */
-                    /* No action as designed          */
-                }
-			 }
-			else
-               {
-                 if (ioen_afdxMsgCtrl[idx].readCycle <= msginfo_p->schedRate)
-                {
-                   /* Not time to read message this cycle, decrement the cycle counter */
-                   ioen_afdxMsgCtrl[idx].readCycle--;
-                }
-                else
-               {
-                /* Robustness, reset counter */
-                   ioen_afdxMsgCtrl[idx].readCycle = msginfo_p->schedRate;
-                }
-          }
-			 
-		}
-       
+        ioen_aaScheduleRead (idx);
 
-        /* Update freshness of message */
-        ioen_ConfirmMsgFreshness (&ioen_afdxMsgCtrl[idx].objCtrl, &msgHdr_p->freshness);
+        idx = nextIdx;
+    }
 
-        msginfo_p++;
+    /* Update freshness, only the messages received or due this cycle */
+    ioen_frUpdate (&ioen_afdxFreshness);
+
+    for (i = 0; i < ioen_afdxFreshness.nofEvents; i++)
+    {
+        idx      = ioen_afdxFreshness.event_p[i];
+        msgHdr_p = (AfdxMessageHeader_t *)(ioen_inMsgBuffer + msgFirst_p[idx].messageHdrOffset);
+
+        if (ioen_frIsExpired (&ioen_afdxFreshness, idx) == TRUE)
+        {
+            msgHdr_p->freshness = IOEN_MSG_UNFRESH;  /* Confirmed unfresh message  */
+        }
+        else
+        {
+            msgHdr_p->freshness = IOEN_MSG_FRESH;    /* Confirmed valid message    */
+        }
+
+        /* Message received or unfresh, process the datasets using it */
+        ioen_incMarkMessage (IOEN_TRANSPORT_A664, idx);
     }
+
+    ioen_frClearEvents (&ioen_afdxFreshness);
+
+    ioen_afdxReadSchedule.cycle++;
 }
 
 
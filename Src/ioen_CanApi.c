@@ -26,9 +26,14 @@
  *
  * DESCRIPTION:
  *   This function initialises the CAN object control structure to allow freshness of message
+ *   and builds the CAN ID hash table, one entry per CAN ID without FS and RCI
+ *   and resolves the frame filter of each CAN ID
+ *   and builds the ranges of the accumulators cleared at the start of each cycle
  *
  * INTERFACE:
  *   Global Data      :  ioen_iomConfig_p
+ *   Global Data      :  ioen_canFreshness
+ *   Global Data      :  ioen_canIdHash
  *
  *   In:      appPeriodMs   : Periodic time of process in millisecs
  *
@@ -37,14 +42,21 @@ void ioen_initCanControl (
     /* IN     */ const Float32_t                   appPeriodMs
 )
 {
-    UInt32_t                  newEntry;
     UInt32_t                  idx;
+    UInt32_t                  slot;
     UInt32_t                  canIdMasked;
     UInt32_t                  idxCanId;
+    UInt32_t                  rci;
     const CanMessageConfig_t *msgInfo_p;
 
     ioen_nofCanMessages = 0;
     msgInfo_p           = CAN_INPUT_MSGINFO_FIRST(ioen_iomConfig_p);
+    ioen_frInitWheel (&ioen_canFreshness, ioen_canDeadline, ioen_canFreshEvent, IOEN_MAX_CAN_MESSAGES_CONFIGURED);
+
+    for (slot = 0; slot < IOEN_CAN_ID_HASH_SIZE; slot++)
+    {
+        ioen_canIdHash[slot] = IOEN_CAN_ID_HASH_EMPTY;
+    }
 
     for (idx = 0; idx < ioen_iomConfig_p->canInputMessageCount; idx++)
     {
@@ -52,67 +64,134 @@ void ioen_initCanControl (
         canIdMasked = msgInfo_p->canId BIT_AND A825_CAN_ID_IGNORE_FS_RCI_MASK;
 
         /* Search for an existing entry with a different RCI */
-        newEntry = TRUE;
-        for (idxCanId = 0; ((idxCanId < ioen_nofCanMessages) AND (newEntry == TRUE)); idxCanId++)
+        slot     = ioen_imcFindSlot (canIdMasked);
+        idxCanId = ioen_canIdHash[slot];
+
+        if (idxCanId == IOEN_CAN_ID_HASH_EMPTY)
         {
-            if (ioen_mrcCanMessageControl[idxCanId].canIdMasked == canIdMasked)
-            {
-                /* An entry allready exists for this CAN ID, with a different source (RCI) */
-                /* Do not add a duplicate entry */
-                newEntry = FALSE;
+            /* New CAN ID, take the empty slot */
+            idxCanId             = ioen_nofCanMessages;
+            ioen_canIdHash[slot] = (UInt16_t)idxCanId;
 
-                /* Just fill out the config pointer */
-                if ((msgInfo_p->canId BIT_AND A825_CAN_ID_RCI_MASK) == 0)
-                {
-                    /* Source 1 */
-                    ioen_mrcCanMessageControl[idxCanId].msgConfigSource1_p = msgInfo_p;
-                }
-                else
-                {
-                    /* Source 2 */
-                    ioen_mrcCanMessageControl[idxCanId].msgConfigSource2_p = msgInfo_p;
-                }
-            }
-            else
-            {
-                /* No action as designed */
-            }
-        }
+            ioen_mrcCanMessageControl[idxCanId].canIdMasked      = canIdMasked;
+            ioen_mrcCanMessageControl[idxCanId].lastBus          = IOEN_CAN_BUS_NONE;
+            ioen_mrcCanMessageControl[idxCanId].msgConfigFirst_p = msgInfo_p;
+            ioen_mrcCanMessageControl[idxCanId].mapInvalidate    = IOEN_CAN_MAP_NONE;
 
-        if (newEntry == TRUE)
-        {
-            ioen_mrcCanMessageControl[ioen_nofCanMessages].canIdMasked = canIdMasked;
-            /* Just fill out the config pointer */
-            if ((msgInfo_p->canId BIT_AND A825_CAN_ID_RCI_MASK) == 0)
+            for (rci = 0; rci < IOEN_CAN_MAX_RCI; rci++)
             {
-                /* Source 1 */
-                ioen_mrcCanMessageControl[ioen_nofCanMessages].msgConfigSource1_p = msgInfo_p;
-            }
-            else
-            {
-                /* Source 2 */
-                ioen_mrcCanMessageControl[ioen_nofCanMessages].msgConfigSource2_p = msgInfo_p;
+                ioen_mrcCanMessageControl[idxCanId].mapFirst[rci] = IOEN_CAN_MAP_NONE;
             }
 
-            /* Initialise Message freshness counters, includes FS validity */
-            ioen_ConfirmInitMsg (msgInfo_p->freshTime,
-                                 msgInfo_p->unfreshTime,
-                                 appPeriodMs,
-                                 &ioen_mrcCanMessageControl[ioen_nofCanMessages].msgValidCtrl);
+            ioen_imcInitFilter (&ioen_mrcCanMessageControl[idxCanId]);
 
-            ioen_nofCanMessages++;
+            /* Initialise Message freshness deadline */
+            ioen_frInitEntry (&ioen_canFreshness, idxCanId, msgInfo_p->unfreshTime, appPeriodMs);
 
+            ioen_nofCanMessages++;
         }
         else
         {
-            /* No action as designed                 */
-            /* Already an entry for this CAN message */
+            /* No action as designed                                                   */
+            /* An entry allready exists for this CAN ID, with a different source (RCI) */
+            /* Do not add a duplicate entry                                            */
         }
 
+        /* Just fill out the config pointer of the source (RCI) */
+        ioen_mrcCanMessageControl[idxCanId].msgConfigSource_p[msgInfo_p->canId BIT_AND A825_CAN_ID_RCI_MASK] = msgInfo_p;
+
         /* Always Increment for worst case execution */
         msgInfo_p = CAN_INPUT_MSGINFO_NEXT(msgInfo_p);
     }
 
+    /* Accumulators cleared at the start of each cycle */
+    ioen_imcInitResetRanges ();
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_addCanBus
+ *
+ * DESCRIPTION:
+ *   This function returns the bus index of a CAN input or output port of the routing table.
+ *   Bus A is index 0, bus B is index 1, an additional bus takes the next free index from 2 on.
+ *
+ * INTERFACE:
+ *
+ *   In:      canType   : CAN Port Type of the routing table entry
+ *   In:      typeA     : CAN Port Type of bus A
+ *   In:      typeB     : CAN Port Type of bus B
+ *   In Out:  nofBuses_p: Number of bus indexes in use
+ *
+ *   Return : Index of the bus, IOEN_MAX_CAN_PORT_NUMBER if all indexes are in use
+ *
+ ******************************************************************/
+static UInt32_t ioen_addCanBus (
+    /* IN     */ const UInt32_t                   canType,
+    /* IN     */ const UInt32_t                   typeA,
+    /* IN     */ const UInt32_t                   typeB,
+    /* IN OUT */       UInt32_t           * const nofBuses_p
+)
+{
+    UInt32_t   busIdx;
+
+    if (canType == typeA)
+    {
+        busIdx = 0;
+    }
+    else if (canType == typeB)
+    {
+        busIdx = 1;
+    }
+    else if (*nofBuses_p < 2)
+    {
+        busIdx = 2;
+    }
+    else
+    {
+        busIdx = *nofBuses_p;
+    }
+
+    if ((busIdx < IOEN_MAX_CAN_PORT_NUMBER) AND (busIdx >= *nofBuses_p))
+    {
+        *nofBuses_p = busIdx + 1;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    return (busIdx);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_scheduleSendCan
+ *
+ * DESCRIPTION:
+ *   This function inserts a CAN output message into the slot of the transmit schedule wheel
+ *   that corresponds to the cycle of its next transmission.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canTxSchedule
+ *
+ *   In:  idx         : index of the output message
+ *
+ ******************************************************************/
+static void ioen_scheduleSendCan (
+    /* IN     */ const UInt32_t                    idx
+)
+{
+    UInt32_t slot;
+
+    slot = ioen_canTxSchedule.sendCycle[idx] % IOEN_CAN_TX_WHEEL_SIZE;
+
+    ioen_canTxSchedule.next[idx]        = ioen_canTxSchedule.slotFirst[slot];
+    ioen_canTxSchedule.slotFirst[slot]  = (UInt16_t)idx;
 }
 
 
@@ -123,15 +202,16 @@ void ioen_initCanControl (
  *
  * DESCRIPTION:
  *   This function creates CAN Rx, CAN Tx, CAN routing ports, and initialises the other data structures
+ *   Bus A and B keep the index 0 and 1, the additional buses follow in the order of the routing table
  *
  * INTERFACE:
- *   Global Data      :  ioen_apexCanBusIdRxA
- *   Global Data      :  ioen_apexCanBusIdRxB
- *   Global Data      :  ioen_apexCanBusIdTxA
- *   Global Data      :  ioen_apexCanBusIdTxB
+ *   Global Data      :  ioen_apexCanBusIdRx
+ *   Global Data      :  ioen_apexCanBusIdTx
+ *   Global Data      :  ioen_nofCanRxBuses
+ *   Global Data      :  ioen_nofCanTxBuses
  *   Global Data      :  ioen_mrcConfigRoutingTable_p
  *   Global Data      :  ioen_mrcCanMessageControl
- *   Global Data      :  ioen_outputPortsInfoCan
+ *   Global Data      :  ioen_canTxSchedule
  *
  *   In:      iom_p         : pointer to IOM configuration
  *   In Out:  iomCanRtTbl_p : CAN routing table
@@ -148,15 +228,23 @@ void ioen_createPortsCan (
     UInt32_t                   msgIdx;
     UInt32_t                   nbPeriod;
     UInt32_t                   portIdx;
+    UInt32_t                   busIdx;
+    UInt32_t                   ownerIdx;
+    UInt32_t                   slot;
     RETURN_CODE_TYPE           ret;
     IOMCanRoutingPortTbl_t    *iomCanPort;
     const CanMessageConfig_t  *msgCfg_p;
 
     /* Initialise global variables */
     ioen_mrcConfigRoutingTable_p = iomCanRtTbl_p;
+    ioen_nofCanRxBuses           = 0;
+    ioen_nofCanTxBuses           = 0;
+
+    memset (&ioen_apexCanBusIdRx, 0, sizeof(ioen_apexCanBusIdRx));
+    memset (&ioen_apexCanBusIdTx, 0, sizeof(ioen_apexCanBusIdTx));
 
     memset (&ioen_mrcCanMessageControl, 0, sizeof(ioen_mrcCanMessageControl));
-    memset (&ioen_outputPortsInfoCan,   0, sizeof(ioen_outputPortsInfoCan));
+    memset (&ioen_canTxSchedule,        0, sizeof(ioen_canTxSchedule));
 
     ioen_initCanControl(appPeriodMs);
 
@@ -169,63 +257,57 @@ void ioen_createPortsCan (
         switch (iomCanPort->canType)
         {
             case IOEN_CAN_PORT_TYPE_RX_A :
-                /* CAN bus input for bus A for this partition */
-                CREATE_QUEUING_PORT(
-                    iomCanPort->portName,
-                    sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
-                    iomCanPort->queueLength,
-                    DESTINATION,
-                    FIFO,
-                    &ioen_apexCanBusIdRxA,
-                    &ret
-                );
-
-                CHECK_CODE("CREATE_QUEUING_PORT", ret);
-                break;
-
             case IOEN_CAN_PORT_TYPE_RX_B :
-                /* CAN bus input for bus B for this partition */
-                CREATE_QUEUING_PORT(
-                    iomCanPort->portName,
-                    sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
-                    iomCanPort->queueLength,
-                    DESTINATION,
-                    FIFO,
-                    &ioen_apexCanBusIdRxB,
-                    &ret
-                );
-
-                CHECK_CODE("CREATE_QUEUING_PORT", ret);
-                break;
+            case IOEN_CAN_PORT_TYPE_RX   :
+                /* CAN bus input for this partition */
+                busIdx = ioen_addCanBus (iomCanPort->canType, IOEN_CAN_PORT_TYPE_RX_A, IOEN_CAN_PORT_TYPE_RX_B, &ioen_nofCanRxBuses);
 
-            case IOEN_CAN_PORT_TYPE_TX_A   :
-                /* CAN bus output for bus A for this partition */
-                CREATE_QUEUING_PORT(
-                    iomCanPort->portName,
-                    sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
-                    iomCanPort->queueLength,
-                    SOURCE,
-                    FIFO,
-                    &ioen_apexCanBusIdTxA,
-                    &ret
-                );
-
-                CHECK_CODE("CREATE_QUEUING_PORT", ret);
+                if (busIdx < IOEN_MAX_CAN_PORT_NUMBER)
+                {
+                    CREATE_QUEUING_PORT(
+                        iomCanPort->portName,
+                        sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
+                        iomCanPort->queueLength,
+                        DESTINATION,
+                        FIFO,
+                        &ioen_apexCanBusIdRx[busIdx],
+                        &ret
+                    );
+
+                    CHECK_CODE("CREATE_QUEUING_PORT", ret);
+                }
+                else
+                {
+                    /* No action as designed                   */
+                    /* More CAN input buses than can be handled */
+                }
                 break;
 
+            case IOEN_CAN_PORT_TYPE_TX_A   :
             case IOEN_CAN_PORT_TYPE_TX_B   :
-                /* CAN bus output for bus B for this partition */
-                CREATE_QUEUING_PORT(
-                    iomCanPort->portName,
-                    sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
-                    iomCanPort->queueLength,
-                    SOURCE,
-                    FIFO,
-                    &ioen_apexCanBusIdTxB,
-                    &ret
-                );
-
-                CHECK_CODE("CREATE_QUEUING_PORT", ret);
+            case IOEN_CAN_PORT_TYPE_TX     :
+                /* CAN bus output for this partition */
+                busIdx = ioen_addCanBus (iomCanPort->canType, IOEN_CAN_PORT_TYPE_TX_A, IOEN_CAN_PORT_TYPE_TX_B, &ioen_nofCanTxBuses);
+
+                if (busIdx < IOEN_MAX_CAN_PORT_NUMBER)
+                {
+                    CREATE_QUEUING_PORT(
+                        iomCanPort->portName,
+                        sizeof(CANMessage_t) * IOEN_MAX_CAN_MESSAGES_PER_CYCLE,     /* max message length */
+                        iomCanPort->queueLength,
+                        SOURCE,
+                        FIFO,
+                        &ioen_apexCanBusIdTx[busIdx],
+                        &ret
+                    );
+
+                    CHECK_CODE("CREATE_QUEUING_PORT", ret);
+                }
+                else
+                {
+                    /* No action as designed                    */
+                    /* More CAN output buses than can be handled */
+                }
                 break;
 
             case IOEN_CAN_PORT_TYPE_ROUTING_TX:
@@ -263,24 +345,55 @@ void ioen_createPortsCan (
         iomCanPort = &iomCanRtTbl_p[portIdx];
     }
 
+    /* The routing entries of the same APEX port share the output queue of the first entry */
+    for (portIdx = 0; iomCanRtTbl_p[portIdx].canType != IOEN_CAN_PORT_TYPE_TERMINATOR; portIdx++)
+    {
+        iomCanRtTbl_p[portIdx].nofOutMsg = 0;
+        iomCanRtTbl_p[portIdx].ownerIdx  = portIdx;
 
-    /* Initialise Output CAN Message info */
+        for (ownerIdx = 0; ownerIdx < portIdx; ownerIdx++)
+        {
+            if (    (iomCanRtTbl_p[portIdx].canType      == IOEN_CAN_PORT_TYPE_ROUTING_TX)
+                AND (iomCanRtTbl_p[ownerIdx].canType     == IOEN_CAN_PORT_TYPE_ROUTING_TX)
+                AND (iomCanRtTbl_p[ownerIdx].apexCanBusId == iomCanRtTbl_p[portIdx].apexCanBusId)
+                AND (iomCanRtTbl_p[portIdx].ownerIdx     == portIdx)
+               )
+            {
+                iomCanRtTbl_p[portIdx].ownerIdx = ownerIdx;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+        }
+    }
+
+
+    /* Initialise Output CAN Message info, and the transmit schedule */
     msgCfg_p = (CanMessageConfig_t *)((void *) iom_p + iom_p->canOutputMessageStart);
 
+    for (slot = 0; slot < IOEN_CAN_TX_WHEEL_SIZE; slot++)
+    {
+        ioen_canTxSchedule.slotFirst[slot] = IOEN_CAN_TX_END;
+    }
+
     for (msgIdx=0; (msgIdx < iom_p->canOutputMessageCount); msgIdx++)
     {
         nbPeriod = CEILING_POS ((Float32_t)msgCfg_p->freshTime / appPeriodMs); /* rounding up */
         if (nbPeriod != 0)
         {
-            ioen_outputPortsInfoCan.port[msgIdx].countdownInit = nbPeriod;
+            ioen_canTxSchedule.period[msgIdx] = nbPeriod;
         }
         else
         {
             /* Message rate is lower than the App Period, send the message every cycle */
-            ioen_outputPortsInfoCan.port[msgIdx].countdownInit = 1;
+            ioen_canTxSchedule.period[msgIdx] = 1;
         }
 
-        ioen_outputPortsInfoCan.port[msgIdx].countdownValue = (SInt32_t) ioen_outputPortsInfoCan.port[msgIdx].countdownInit;
+        /* First transmission after one period, including the current cycle */
+        ioen_canTxSchedule.msgCfg_p[msgIdx]  = msgCfg_p;
+        ioen_canTxSchedule.sendCycle[msgIdx] = ioen_canTxSchedule.period[msgIdx] - 1;
+        ioen_scheduleSendCan (msgIdx);
 
         /* Next message config is after current config and its simple mappings */
         msgCfg_p = (const CanMessageConfig_t *)((const Byte_t *)msgCfg_p + msgCfg_p->size);
@@ -299,11 +412,15 @@ void ioen_createPortsCan (
  *
  * DESCRIPTION:
  *   This function transmits the A825 APEX ports
+ *   The messages due in this cycle are taken from the slot of the transmit schedule wheel.
+ *   Their frames are built once into one array, in configuration order, and the array is sent
+ *   to each CAN bus with as few port calls as the port message size allows.
  *
  * INTERFACE:
- *   Global Data:   ioen_outputPortsInfoCan
- *   Global Data:   ioen_iomConfig_p
+ *   Global Data:   ioen_canTxSchedule
  *   Global Data:   ioen_outParamBuffer
+ *   Global Data:   ioen_apexCanBusIdTx
+ *   Global Data:   ioen_nofCanTxBuses
  *
  ******************************************************************/
 void ioen_writeMessagesCan (
@@ -311,48 +428,100 @@ void ioen_writeMessagesCan (
 )
 {
     UInt32_t                   idx;                /* index of write message  */
+    UInt32_t                   nextIdx;
+    UInt32_t                   dueIdx;
+    UInt32_t                   slot;
+    UInt32_t                   busIdx;             /* index of output bus     */
+    UInt32_t                   first;              /* first frame of a port call */
+    UInt32_t                   nofFrames;          /* frames of a port call   */
     const CanMessageConfig_t  *msgCfg_p;
     RETURN_CODE_TYPE           ret;                /* return code             */
-    CANMessage_t               canOutputMessage;   /* buffer for one CAN message, no global message buffer like AFDX */
-    const IOMConfigHeader_t   *iom_p;
+    CANMessage_t              *frame_p;
+    CanTxSchedule_t           *sched_p;
+
+    sched_p = &ioen_canTxSchedule;
 
     if (ioen_outParamBuffer != NULL_PTR)
     {
-        /* Get pointer to IOM Configuration */
-        iom_p = ioen_iomConfig_p;
+        /* Take the messages of this slot from the wheel, they are inserted again below */
+        sched_p->nofDue = 0;
+        slot            = sched_p->cycle % IOEN_CAN_TX_WHEEL_SIZE;
+        idx             = sched_p->slotFirst[slot];
+        sched_p->slotFirst[slot] = IOEN_CAN_TX_END;
 
-        msgCfg_p = (CanMessageConfig_t *)((void *) iom_p + iom_p->canOutputMessageStart);
-
-        for (idx = 0; idx < iom_p->canOutputMessageCount; idx++)
+        while (idx != IOEN_CAN_TX_END)
         {
-            if (ioen_outputPortsInfoCan.port[idx].countdownValue > 1)
+            nextIdx = sched_p->next[idx];
+
+            if (sched_p->sendCycle[idx] == sched_p->cycle)
             {
-                /* If the port countdown value has not reached 0, it is too early to send the message, */
-                /* decrement the countdown and move to the next message                                */
-                ioen_outputPortsInfoCan.port[idx].countdownValue--;
+                /* It's time to send the message, insert it into the due list in configuration order */
+                dueIdx = sched_p->nofDue;
+                while ((dueIdx > 0) AND (sched_p->due[dueIdx - 1] > idx))
+                {
+                    sched_p->due[dueIdx] = sched_p->due[dueIdx - 1];
+                    dueIdx--;
+                }
+                sched_p->due[dueIdx] = (UInt16_t)idx;
+                sched_p->nofDue++;
+
+                sched_p->sendCycle[idx] += sched_p->period[idx];
             }
             else
             {
-                /* It's time to send the message, reinit the corresponding countdown */
-                ioen_outputPortsInfoCan.port[idx].countdownValue = (SInt32_t)ioen_outputPortsInfoCan.port[idx].countdownInit;
+                /* No action as designed            */
+                /* Due in a later turn of the wheel */
+            }
 
-                /* Setup the output message CAN ID */
-                canOutputMessage.canId = msgCfg_p->canId;
+            ioen_scheduleSendCan (idx);
 
-                /* Setup the output message Data */
-                ioen_omcProcessOutputParametersCan (msgCfg_p, ioen_outParamBuffer, &canOutputMessage.data[0]);
+            idx = nextIdx;
+        }
 
-                /* Send the output message on a Queuing Port to the CAN bus A, NB: A message is lways transmitted on both physical CAN busses */
-                SEND_QUEUING_MESSAGE(ioen_apexCanBusIdTxA, (void *) &canOutputMessage, msgCfg_p->messageLength, 0, &ret);
-                CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
+        sched_p->cycle++;
 
-                /* Send the output message on a Queuing Port to the CAN bus A, NB: A message is lways transmitted on both physical CAN busses */
-                SEND_QUEUING_MESSAGE(ioen_apexCanBusIdTxB, (void *) &canOutputMessage, msgCfg_p->messageLength, 0, &ret);
-                CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
-            }
+        /* Build the frames of the due messages once */
+        for (dueIdx = 0; dueIdx < sched_p->nofDue; dueIdx++)
+        {
+            msgCfg_p = sched_p->msgCfg_p[sched_p->due[dueIdx]];
+            frame_p  = &sched_p->frame[dueIdx];
+
+            memset (frame_p, 0, sizeof(CANMessage_t));
+
+            /* Setup the output message CAN ID */
+            frame_p->canId  = msgCfg_p->canId;
+            frame_p->nbytes = msgCfg_p->messageLength;
+
+            /* Setup the output message Data */
+            ioen_omcProcessOutputParametersCan (msgCfg_p, ioen_outParamBuffer, &frame_p->data[0]);
+        }
 
-            /* Next message config is after current config and its simple mappings */
-            msgCfg_p = (const CanMessageConfig_t *)((const Byte_t *)msgCfg_p + msgCfg_p->size);
+        /* Send the frames on a Queuing Port to each CAN bus, NB: A message is always transmitted on all physical CAN busses */
+        for (busIdx = 0; busIdx < ioen_nofCanTxBuses; busIdx++)
+        {
+            if (ioen_apexCanBusIdTx[busIdx] != 0)
+            {
+                for (first = 0; first < sched_p->nofDue; first += IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
+                {
+                    nofFrames = sched_p->nofDue - first;
+                    if (nofFrames > IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
+                    {
+                        /* Port message size is IOEN_MAX_CAN_MESSAGES_PER_CYCLE frames */
+                        nofFrames = IOEN_MAX_CAN_MESSAGES_PER_CYCLE;
+                    }
+                    else
+                    {
+                        /* No action as designed */
+                    }
+
+                    SEND_QUEUING_MESSAGE(ioen_apexCanBusIdTx[busIdx], (MESSAGE_ADDR_TYPE)&sched_p->frame[first], (sizeof(CANMessage_t) * nofFrames), 0, &ret);
+                    CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
+                }
+            }
+            else
+            {
+                /* No action as designed, bus not configured */
+            }
         }
     }
     else
@@ -374,19 +543,30 @@ void ioen_writeMessagesCan (
  *
  * INTERFACE:
  *
- *   Global Data      :  ioen_apexCanBusIdRxA
- *   Global Data      :  ioen_apexCanBusIdRxB
+ *   Global Data      :  ioen_apexCanBusIdRx
+ *   Global Data      :  ioen_nofCanRxBuses
  *
  ******************************************************************/
 void ioen_readMessagesCan (
     /*        */ void
 )
 {
-    /* resets all addition parameters to 0, and message routing lists to zero */
+    UInt32_t    busIdx;
+
+    /* resets all addition parameters to 0 */
     ioen_imcStartInputCan ();
 
-    ioen_imcHandleBus (ioen_apexCanBusIdRxA);
-    ioen_imcHandleBus (ioen_apexCanBusIdRxB);
+    for (busIdx = 0; busIdx < ioen_nofCanRxBuses; busIdx++)
+    {
+        if (ioen_apexCanBusIdRx[busIdx] != 0)
+        {
+            ioen_imcHandleBus (ioen_apexCanBusIdRx[busIdx], busIdx);
+        }
+        else
+        {
+            /* No action as designed, bus not configured */
+        }
+    }
 
     /* Check freshness of messages not received */
     ioen_imcCheckMessageFreshness ();
@@ -395,4 +575,48 @@ void ioen_readMessagesCan (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_runCanReader
+ *
+ * DESCRIPTION:
+ *   This function reads the messages of all CAN buses into the receive rings.
+ *   It is called periodically by the reader process of the application, see ioen_setCanReader,
+ *   the messages are processed by the next ioen_readMessagesCan.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  ioen_canDrain
+ *   Global Data      :  ioen_apexCanBusIdRx
+ *   Global Data      :  ioen_nofCanRxBuses
+ *
+ ******************************************************************/
+void ioen_runCanReader (
+    /*        */ void
+)
+{
+    UInt32_t    busIdx;
+
+    if (ioen_canDrain.reader == TRUE)
+    {
+        for (busIdx = 0; busIdx < ioen_nofCanRxBuses; busIdx++)
+        {
+            if (ioen_apexCanBusIdRx[busIdx] != 0)
+            {
+                ioen_imcFillRing (ioen_apexCanBusIdRx[busIdx], busIdx);
+            }
+            else
+            {
+                /* No action as designed, bus not configured */
+            }
+        }
+    }
+    else
+    {
+        /* No action as designed, the buses are read in the cycle */
+    }
+}
+
+
+
 
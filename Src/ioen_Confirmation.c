@@ -16,37 +16,6 @@
 #include "ioen_IomLocal.h"
 
 
-/******************************************************************
- * FUNCTION NAME:
- *   ioen_ConfirmInitMsg
- *
- * DESCRIPTION:
- *   This function initialises an object control structure for confirmation of values.
- *
- * INTERFACE:
- *
- *   In:  freshTime   : Max duration, before a message is marked as fresh in ms
- *   In:  unfreshTime : Max duration, before a message is marked as unfresh in ms
- *   In:  appPeriodMs : Periodic time of process in millisecs
- *   In Out:  ctrl_p  : Confirmation control object
- *
- ******************************************************************/
-void ioen_ConfirmInitMsg (
-    /* IN     */ const UInt32_t                      freshTime,
-    /* IN     */ const UInt32_t                      unfreshTime,
-    /* IN     */ const Float32_t                     appPeriodMs,
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p
-)
-{
-    ctrl_p->newData            = FALSE;
-    ctrl_p->cycle              = 1; /* Initial value of one will force an initial unfresh transition */
-    ctrl_p->limitCycleValid    = (UInt32_t)( ((Float32_t)freshTime   / appPeriodMs) + 0.99); /* plus 0,99 for rounding up */
-    ctrl_p->limitCycleInvalid  = (UInt32_t)( ((Float32_t)unfreshTime / appPeriodMs) + 0.99); /* plus 0,99 for rounding up */
-    ctrl_p->limitCycleValid++;    /* plus 1 because the decrement is before checking */
-    ctrl_p->limitCycleInvalid++;  /* plus 1 because the decrement is before checking */
-}
-
-
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_ConfirmInitParam
@@ -349,81 +318,6 @@ void ioen_ConfirmInitParamValidity (
 }
 
 
-/******************************************************************
- * FUNCTION NAME:
- *   ioen_ConfirmSetNewMsgData
- *
- * DESCRIPTION:
- *   This function signals that new data has been received for confirmation of values.
- *
- * INTERFACE:
- *
- *   In Out:  ctrl_p  : Confirmation control object
- *
- ******************************************************************/
-void ioen_ConfirmSetNewMsgData (
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p
-)
-{
-    ctrl_p->newData  = TRUE;
-}
-
-
-
-/******************************************************************
- * FUNCTION NAME:
- *   ioen_ConfirmMsgFreshness
- *
- * DESCRIPTION:
- *   This function sets confirmed valid or invalid values.
- *
- * INTERFACE:
- *
- *   In Out:  ctrl_p  : Confirmation control object
- *   In Out:  value_p : Value to update
- *
- ******************************************************************/
-void ioen_ConfirmMsgFreshness (
-    /* IN OUT */       IomObjectCtrlData_t   * const ctrl_p,
-    /* IN OUT */       UInt32_t              * const value_p
-)
-{
-    /* End of Fresh cycle, check validity of message */
-    if (ctrl_p->newData == TRUE)
-    {
-        *value_p = IOEN_MSG_FRESH;  /* Confirmed valid message  */
-
-        /* Reset cycle */
-        ctrl_p->cycle   = ctrl_p->limitCycleInvalid;
-        ctrl_p->newData = FALSE;
-    }
-    else
-    {
-        if (ctrl_p->cycle > 0)
-        {
-            /* Decrement cycle counter */
-            ctrl_p->cycle--;
-
-            if (ctrl_p->cycle == 0)
-            {
-                *value_p = IOEN_MSG_UNFRESH;  /* Confirmed unfresh message  */
-            }
-            else
-            {
-                /* No action, as designed */
-                /* Message is still fresh */
-            }
-        }
-        else
-        {
-            /* No action, as defined   */
-            /* Message is unfresh      */
-        }
-    }
-}
-
-
-
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_ConfirmObjectValidity
@@ -431,6 +325,13 @@ void ioen_ConfirmMsgFreshness (
  * DESCRIPTION:
  *   This function sets confirmed valid or invalid validities.
  *
+ *   Per object the state machine is:
+ *     - validity unchanged : the cycle counter is decremented (if not 0), at 0 the current validity is confirmed
+ *     - changed to valid   : the cycle counter restarts at limitCycleValid,   last validity = current validity
+ *     - changed to invalid : the cycle counter restarts at limitCycleInvalid, last validity = current validity
+ *   The state machine is evaluated with masks instead of branches, so the execution time does not
+ *   depend on the validities and the loop has no mispredicted branches.
+ *
  * INTERFACE:
  *
  *   In    :  nofSources : number of validity entries
@@ -443,6 +344,14 @@ void ioen_ConfirmObjectValidity (
 )
 {
     UInt32_t             idx;
+    UInt32_t             cycle;
+    UInt32_t             limit;
+    UInt32_t             sameMask;      /* all ones if the validity did not change           */
+    UInt32_t             validMask;     /* all ones if the current validity is valid         */
+    UInt32_t             confirmMask;   /* all ones if the validity is confirmed this cycle  */
+    UInt32_t             current;
+    UInt32_t             last;
+    UInt32_t             confirmed;
     Valid_t             *validity_p;
     IomObjectCtrlData_t *objCtrl_p;
 
@@ -452,46 +361,30 @@ void ioen_ConfirmObjectValidity (
         validity_p = &ctrl[idx].validity;
         objCtrl_p  = &ctrl[idx];
 
-        if (validity_p->current.value == validity_p->last.value)
-        {
-            /* No change in validity, Check if end of cycle */
-            if (objCtrl_p->cycle > 0)
-            {
-                /* No change in validity, decrement counter */
-                objCtrl_p->cycle--;
-
-                if (objCtrl_p->cycle == 0)
-                {
-                    /* Confirmed */
-                    validity_p->confirmed = validity_p->current;
-                }
-                else
-                {
-                    /* No action, as designed */
-                    /* Not yet confirmed      */
-                }
-            }
-            else
-            {
-                /* No action, as designed */
-                /* Still confirmed        */
-            }
-        }
-        else if (validity_p->current.value == IOEN_GLOB_DATA_VALID)
-        {
-            /* Changed to valid, restart counter  */
-            /* Change of value, not yet confirmed */
-            objCtrl_p->cycle = objCtrl_p->limitCycleValid;
-            validity_p->last = validity_p->current;
-        }
-        else
-        {
-            /* Changed to invalid or unfresh, restart counter */
-            /* Change of value, not yet confirmed             */
-            objCtrl_p->cycle = objCtrl_p->limitCycleInvalid;
-            validity_p->last = validity_p->current;
-        }
+        current   = * ((UInt32_t *) &validity_p->current);
+        last      = * ((UInt32_t *) &validity_p->last);
+        confirmed = * ((UInt32_t *) &validity_p->confirmed);
+        cycle     = objCtrl_p->cycle;
+
+        sameMask    = 0 - (UInt32_t)(validity_p->current.value == validity_p->last.value);
+        validMask   = 0 - (UInt32_t)(validity_p->current.value == IOEN_GLOB_DATA_VALID);
+
+        /* No change in validity: confirmed when the counter reaches 0 in this cycle */
+        confirmMask = sameMask BIT_AND (0 - (UInt32_t)(cycle == 1));
+
+        /* No change in validity: decrement counter if not yet 0 */
+        cycle = cycle - (UInt32_t)(cycle > 0);
 
+        /* Change of value, not yet confirmed: restart counter with the limit of the new validity */
+        limit = objCtrl_p->limitCycleInvalid BIT_XOR ((objCtrl_p->limitCycleValid BIT_XOR objCtrl_p->limitCycleInvalid) BIT_AND validMask);
+
+        objCtrl_p->cycle = (Byte_t)((cycle BIT_AND sameMask) BIT_OR (limit BIT_AND BIT_NOT sameMask));
+
+        last      = (last    BIT_AND sameMask)    BIT_OR (current BIT_AND BIT_NOT sameMask);
+        confirmed = (current BIT_AND confirmMask) BIT_OR (confirmed BIT_AND BIT_NOT confirmMask);
+
+        * ((UInt32_t *) &validity_p->last)      = last;
+        * ((UInt32_t *) &validity_p->confirmed) = confirmed;
     }
 }
 
@@ -512,46 +405,8 @@ void ioen_ConfirmObjectValidityItem (
     /* IN OUT */       IomObjectCtrlData_t      * const ctrl_p
 )
 {
-    if (ctrl_p->validity.current.value == ctrl_p->validity.last.value)
-    {
-        /* No change in validity, Check if end of cycle */
-        if (ctrl_p->cycle > 0)
-        {
-            /* No change in validity, decrement counter */
-            ctrl_p->cycle--;
-
-            if (ctrl_p->cycle == 0)
-            {
-                /* Confirmed */
-                ctrl_p->validity.confirmed = ctrl_p->validity.current;
-            }
-            else
-            {
-                /* No action, as designed */
-                /* Not yet confirmed      */
-            }
-        }
-        else
-        {
-            /* No action, as designed */
-            /* Still confirmed        */
-        }
-    }
-    else if (ctrl_p->validity.current.value == IOEN_GLOB_DATA_VALID)
-    {
-        /* Changed to valid, restart counter  */
-        /* Change of value, not yet confirmed */
-        ctrl_p->cycle         = ctrl_p->limitCycleValid;
-        ctrl_p->validity.last = ctrl_p->validity.current;
-    }
-    else
-    {
-        /* Changed to invalid or unfresh, restart counter */
-        /* Change of value, not yet confirmed             */
-        ctrl_p->cycle         = ctrl_p->limitCycleInvalid;
-        ctrl_p->validity.last = ctrl_p->validity.current;
-    }
-
+    /* Same state machine as for an array of objects */
+    ioen_ConfirmObjectValidity (1, ctrl_p);
 }
 
 
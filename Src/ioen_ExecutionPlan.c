@@ -0,0 +1,1146 @@
+/***************************************************************
+ * COPYRIGHT:
+ *   2013-2015
+ *   Chinese Aeronautical Radio Electronics Research Institute
+ *   All Rights Reserved
+ *
+ * FILE NAME:
+ *   ioen_ExecutionPlan.c
+ *
+ * FILE DESCRIPTION:
+ *   This module compiles the AFDX/A429 input processing into a flat execution plan at start up.
+ *   The plan holds the resolved configuration pointers and converter functions of all datasets,
+ *   so the cyclic processing does not walk the variable size configuration records again.
+ *   The conversions are grouped per input mapping type, so each type is converted in one loop
+ *   (see ioen_inputBatchConverters). The results are identical to the configuration walk
+ *   in ioen_processInputAfdxA429.
+ *
+***************************************************************/
+
+
+#include "ioen_IomLocal.h"
+
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epAddCondition
+ *
+ * DESCRIPTION:
+ *   This function looks up a validity condition in the distinct conditions of the plan,
+ *   and adds it if it is not found. Conditions are the same when their type and complete
+ *   configuration (message, offsets, sizes and range) are the same, so they have the same result.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  conditionType : type of the condition
+ *   In:  condition_p   : configuration of the condition
+ *   Out: entry_p       : entry in condition[]
+ *
+ *   Return:  TRUE if the condition fits in the plan
+ *
+ ******************************************************************/
+static Bool_t ioen_epAddCondition (
+    /* IN     */ const UInt32_t                          conditionType,
+    /* IN     */ const ValidityConditionConfig_t * const condition_p,
+    /*    OUT */       UInt32_t                  * const entry_p
+)
+{
+    UInt32_t                  hash;
+    UInt32_t                  idx;
+    UInt32_t                  entry;
+    Bool_t                    found;
+    const Byte_t             *byte_p;
+    InputExecPlan_t          *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+
+    /* FNV-1a hash of the type and configuration */
+    hash   = 2166136261U ^ conditionType;
+    byte_p = (const Byte_t *)condition_p;
+    for (idx = 0; idx < sizeof(ValidityConditionConfig_t); idx++)
+    {
+        hash = (hash ^ byte_p[idx]) * 16777619U;
+    }
+
+    /* Linear probing, the table is at least twice the number of conditions */
+    found = FALSE;
+    entry = 0;
+    hash  = hash BIT_AND (IOEN_EP_CONDITION_HASH_SIZE - 1);
+
+    while ((plan_p->condHash[hash] != 0) AND (found == FALSE))
+    {
+        entry = plan_p->condHash[hash] - 1;
+
+        if (    (plan_p->condition[entry].conditionType == conditionType)
+            AND (memcmp (plan_p->condition[entry].condition_p, condition_p, sizeof(ValidityConditionConfig_t)) == 0)
+           )
+        {
+            found = TRUE;
+        }
+        else
+        {
+            hash = (hash + 1) BIT_AND (IOEN_EP_CONDITION_HASH_SIZE - 1);
+        }
+    }
+
+    if (found == FALSE)
+    {
+        if (    (plan_p->nofConditions < IOEN_EP_MAX_CONDITIONS)
+            AND (conditionType         < IOEN_NUMBER_CONDITION_TYPES)
+           )
+        {
+            entry = plan_p->nofConditions;
+
+            plan_p->condition[entry].condition_p   = condition_p;
+            plan_p->condition[entry].conditionType = conditionType;
+            plan_p->condition[entry].cycle         = 0;
+            plan_p->condHash[hash]                 = (UInt16_t)(entry + 1);
+            plan_p->nofConditions++;
+
+            found = TRUE;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    *entry_p = entry;
+
+    return found;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epAddConditions
+ *
+ * DESCRIPTION:
+ *   This function links the validity conditions of all sources of a dataset to the distinct conditions.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  validityLogic_p : first validity logic of the dataset
+ *   In:  numSources      : number of sources of the dataset
+ *
+ *   Return:  TRUE if the conditions fit in the plan
+ *
+ ******************************************************************/
+static Bool_t ioen_epAddConditions (
+    /* IN     */ const ValidityConfig_t     * const validityLogic_p,
+    /* IN     */ const UInt32_t                     numSources
+)
+{
+    UInt32_t                  srcIdx;
+    UInt32_t                  valIdx;
+    UInt32_t                  entry;
+    Bool_t                    fits;
+    InputExecPlan_t          *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+    fits   = (numSources <= IOEN_MAX_SOURCES_PER_INPUT);
+
+    for (srcIdx = 0; (srcIdx < numSources) AND (fits == TRUE); srcIdx++)
+    {
+        fits = (validityLogic_p[srcIdx].numConditions <= IOEN_MAX_VALIDITY_CONDITIONS);
+
+        for (valIdx = 0; (valIdx < validityLogic_p[srcIdx].numConditions) AND (fits == TRUE); valIdx++)
+        {
+            fits = ioen_epAddCondition (validityLogic_p[srcIdx].conditionType[valIdx],
+                                        &validityLogic_p[srcIdx].condition[valIdx],
+                                        &entry);
+
+            if ((fits == TRUE) AND (plan_p->nofCondRefs < IOEN_EP_MAX_CONDITION_REFS))
+            {
+                plan_p->condRef[plan_p->nofCondRefs] = (UInt16_t)entry;
+                plan_p->nofCondRefs++;
+            }
+            else
+            {
+                fits = FALSE;
+            }
+        }
+    }
+
+    return fits;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epAddDataset
+ *
+ * DESCRIPTION:
+ *   This function adds one dataset with its conversions and parameter routings to the plan.
+ *   In the count pass only the conversions per input mapping type are counted,
+ *   in the fill pass the conversions are stored grouped by input mapping type.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *   Global Data      :  ioen_inObjectCtrl
+ *
+ *   In:  dataset_p    : pointer to dataset header
+ *   In:  dsIdx        : index of the dataset
+ *   In:  singleSource : TRUE = dataset with a single source, FALSE = multiple sources
+ *   In:  fillPass     : FALSE = count pass, TRUE = fill pass
+ *
+ *   Return:  TRUE if the dataset fits in the plan
+ *
+ ******************************************************************/
+static Bool_t ioen_epAddDataset (
+    /* IN     */ const InputDatasetHeader_t * const dataset_p,
+    /* IN     */ const UInt32_t                     dsIdx,
+    /* IN     */ const Bool_t                       singleSource,
+    /* IN     */ const Bool_t                       fillPass
+)
+{
+    UInt32_t                    parIdx;
+    UInt32_t                    srcIdx;
+    UInt32_t                    type;
+    UInt32_t                    entry;
+    Bool_t                      fits;
+    Bool_t                      converted;
+    const ParamMappingConfig_t *parConfig_p;
+    const InputSignalConfig_t  *sigConfig_p;
+    ExecPlanDataset_t          *planDs_p;
+    InputExecPlan_t            *plan_p;
+
+    plan_p   = &ioen_inputExecPlan;
+    planDs_p = &plan_p->dataset[dsIdx];
+    fits     = TRUE;
+
+    /* Single source datasets are only converted with one source, the internal parameters (no source) have no conversion */
+    converted = (singleSource == FALSE) OR (dataset_p->numSources == 1);
+
+    /* first logic starts after dataset header */
+    planDs_p->dataset_p       = dataset_p;
+    planDs_p->validityLogic_p = (const ValidityConfig_t *)(dataset_p + 1);
+    planDs_p->firstCopy       = (UInt16_t)plan_p->nofCopies;
+    planDs_p->firstCondRef    = plan_p->nofCondRefs;
+
+    if ((fillPass == TRUE) AND (converted == TRUE))
+    {
+        /* Link the validity conditions of all sources to the distinct conditions */
+        fits = ioen_epAddConditions (planDs_p->validityLogic_p, dataset_p->numSources);
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    /* first parameter starts after logicSize bytes */
+    parConfig_p = (const ParamMappingConfig_t *)((const void *)planDs_p->validityLogic_p + dataset_p->logicSize);
+
+    for (parIdx = 0; (parIdx < dataset_p->numParams) AND (fits == TRUE); parIdx++)
+    {
+        /* Obtain the address of the first signal configuration */
+        sigConfig_p = (const InputSignalConfig_t *) ((const Byte_t *)parConfig_p + sizeof(ParamMappingConfig_t));
+
+        if (plan_p->nofCopies < IOEN_EP_MAX_COPIES)
+        {
+            if (fillPass == TRUE)
+            {
+                plan_p->copy[plan_p->nofCopies].parConfig_p = parConfig_p;
+                plan_p->copy[plan_p->nofCopies].sigConfig_p = sigConfig_p;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+            plan_p->nofCopies++;
+        }
+        else
+        {
+            fits = FALSE;
+        }
+
+        for (srcIdx = 0; (srcIdx < parConfig_p->numSources) AND (converted == TRUE) AND (fits == TRUE); srcIdx++)
+        {
+            type = sigConfig_p[srcIdx].type;
+
+            if (    (plan_p->nofConverts < IOEN_EP_MAX_CONVERTS)
+                AND (type < IOEN_NUMBER_INPUT_MAPPING_TYPES)
+               )
+            {
+                if (fillPass == TRUE)
+                {
+                    entry = plan_p->typeFirst[type] + plan_p->typeCount[type];
+
+                    plan_p->convert[entry].parConfig_p = parConfig_p;
+                    plan_p->convert[entry].sigConfig_p = &sigConfig_p[srcIdx];
+                    plan_p->convert[entry].validity_p  = &ioen_inObjectCtrl[dsIdx][srcIdx].validity.current;
+                    plan_p->convert[entry].hostWord_p  = NULL_PTR;
+                    plan_p->convert[entry].hostSlot    = IOEN_EP_NO_HOST_WORD;
+                    plan_p->convert[entry].dsIdx       = dsIdx;
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+                plan_p->typeCount[type]++;
+                plan_p->nofConverts++;
+            }
+            else
+            {
+                fits = FALSE;
+            }
+        }
+
+        /* Next param */
+        parConfig_p = (const void *)parConfig_p + IOEN_SIZEOF_PARAM_MAPPING_CONFIG(parConfig_p);
+    }
+
+    planDs_p->nofCopies = (UInt16_t)(plan_p->nofCopies - planDs_p->firstCopy);
+
+    return fits;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epAddAllDatasets
+ *
+ * DESCRIPTION:
+ *   This function adds all single and multiple source datasets to the plan.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
+ *
+ *   Return:  TRUE if all datasets fit in the plan
+ *
+ ******************************************************************/
+static Bool_t ioen_epAddAllDatasets (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p,
+    /* IN     */ const Bool_t                       fillPass
+)
+{
+    UInt32_t                    idx;
+    UInt32_t                    dsIdx;
+    Bool_t                      fits;
+    const InputDatasetHeader_t *dataset_p;
+    InputExecPlan_t            *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+    fits   = TRUE;
+
+    /* Datasets that have only one source */
+    dataset_p = (const InputDatasetHeader_t *) ((const void *)(iom_p) + iom_p->afdxInputDatasetStart);
+    dsIdx     = 0;
+
+    for (idx = 0; (idx < plan_p->nofSingle) AND (fits == TRUE); idx++)
+    {
+        fits      = ioen_epAddDataset (dataset_p, dsIdx, TRUE, fillPass);
+        dataset_p = (const void *)dataset_p + dataset_p->datasetSize;
+        dsIdx++;
+    }
+
+    /* Datasets that have multiple sources */
+    dataset_p = (const InputDatasetHeader_t *) ((const void *)(iom_p) + iom_p->afdxInputDatasetMultiStart);
+
+    for (idx = 0; (idx < plan_p->nofMulti) AND (fits == TRUE); idx++)
+    {
+        fits      = ioen_epAddDataset (dataset_p, dsIdx, FALSE, fillPass);
+        dataset_p = (const void *)dataset_p + dataset_p->datasetSize;
+        dsIdx++;
+    }
+
+    return fits;
+}
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epAddSelections
+ *
+ * DESCRIPTION:
+ *   This function adds all selection sets that perform a selection to the plan.
+ *   Sets with only one source (IOEN_SOURCE_ONE) have no selection and are left out.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *
+ *   Return:  TRUE if all sets fit in the plan
+ *
+ ******************************************************************/
+static Bool_t ioen_epAddSelections (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                        curSet;
+    Bool_t                          fits;
+    const SelectionSetlistConfig_t *iomSetlistConfig_p;
+    const SelectionSetConfig_t     *iomSetConfig_p;
+    InputExecPlan_t                *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+    fits   = TRUE;
+
+    /* Get pointers to start of source information in the configuration */
+    iomSetlistConfig_p = (const SelectionSetlistConfig_t *) ((const void *)(iom_p) + iom_p->selectionSetStart);
+    iomSetConfig_p     = (const SelectionSetConfig_t *)     ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+
+    for (curSet = 0; (curSet < iomSetlistConfig_p->nofSets) AND (fits == TRUE); curSet++)
+    {
+        if (iomSetConfig_p->criteria == IOEN_SOURCE_ONE)
+        {
+            /* No action as designed                                      */
+            /* No source selection for parameters with only one source    */
+        }
+        else if (plan_p->nofSelections < IOEN_EP_MAX_SELECTIONS)
+        {
+            plan_p->selection[plan_p->nofSelections].setConfig_p = iomSetConfig_p;
+            plan_p->selection[plan_p->nofSelections].curSet      = curSet;
+            plan_p->nofSelections++;
+        }
+        else
+        {
+            fits = FALSE;
+        }
+
+        /* Increment pointer to next set */
+        iomSetConfig_p = (const SelectionSetConfig_t *) ((const void *)(iomSetConfig_p) + iomSetConfig_p->setConfigSize);
+    }
+
+    return fits;
+}
+
+
+
+#if TARGET_BYTE_ORDER==LITTLE_ENDIAN
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epIsHostWordSignal
+ *
+ * DESCRIPTION:
+ *   This function checks if a signal reads an aligned 32 bit word of an AFDX message
+ *   with a batch converter that can use the word in host byte order.
+ *
+ * INTERFACE:
+ *
+ *   In:  sigConfig_p : Input Signal Config
+ *
+ *   Return:  TRUE if the signal word can be kept in host byte order
+ *
+ ******************************************************************/
+static Bool_t ioen_epIsHostWordSignal (
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p
+)
+{
+    Bool_t hostWord;
+
+    if (    (sigConfig_p->transport           == IOEN_TRANSPORT_A664)
+        AND (sigConfig_p->msgIdx              <  IOEN_MAX_RX_PORT_NUMBER)
+        AND ((sigConfig_p->offByte BIT_AND 3) == 0)
+        AND (   (sigConfig_p->type == IOEN_INPUT_MAPPING_UINT32)
+             OR (sigConfig_p->type == IOEN_INPUT_MAPPING_INT32)
+             OR (sigConfig_p->type == IOEN_INPUT_MAPPING_A429BNR)
+             OR (sigConfig_p->type == IOEN_INPUT_MAPPING_A429UBNR)
+            )
+       )
+    {
+        hostWord = TRUE;
+    }
+    else
+    {
+        hostWord = FALSE;
+    }
+
+    return hostWord;
+}
+#endif
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epInitHostWords
+ *
+ * DESCRIPTION:
+ *   This function builds the list of signal words per AFDX message that are kept in host byte order.
+ *   A word read by several signals is stored once, so it is swapped once per received message.
+ *   Only little endian targets swap, on big endian targets the list stays invalid.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ ******************************************************************/
+static void ioen_epInitHostWords (
+    /*        */       void
+)
+{
+    InputExecPlan_t          *plan_p;
+#if TARGET_BYTE_ORDER==LITTLE_ENDIAN
+    UInt32_t                  idx;
+    UInt32_t                  slot;
+    UInt32_t                  last;
+    UInt32_t                  msgIdx;
+    UInt32_t                  nofWords;
+    ExecPlanConvert_t        *convert_p;
+#endif
+
+    plan_p              = &ioen_inputExecPlan;
+    plan_p->hostValid   = FALSE;
+
+#if TARGET_BYTE_ORDER==LITTLE_ENDIAN
+    /* Reserve the words of each message (a shared word is counted for each signal) */
+    convert_p = plan_p->convert;
+    for (idx = 0; idx < plan_p->nofConverts; idx++)
+    {
+        if (ioen_epIsHostWordSignal (convert_p->sigConfig_p) == TRUE)
+        {
+            plan_p->msgWordCount[convert_p->sigConfig_p->msgIdx]++;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+        convert_p++;
+    }
+
+    nofWords = 0;
+    for (msgIdx = 0; msgIdx < IOEN_MAX_RX_PORT_NUMBER; msgIdx++)
+    {
+        plan_p->msgWordFirst[msgIdx] = (UInt16_t)nofWords;
+        nofWords                    += plan_p->msgWordCount[msgIdx];
+        plan_p->msgWordCount[msgIdx] = 0;
+    }
+
+    if (nofWords <= IOEN_EP_MAX_HOST_WORDS)
+    {
+        /* Store each word once per message, and link the signals to it */
+        convert_p = plan_p->convert;
+        for (idx = 0; idx < plan_p->nofConverts; idx++)
+        {
+            if (ioen_epIsHostWordSignal (convert_p->sigConfig_p) == TRUE)
+            {
+                msgIdx = convert_p->sigConfig_p->msgIdx;
+                slot   = plan_p->msgWordFirst[msgIdx];
+                last   = slot + plan_p->msgWordCount[msgIdx];
+
+                while ((slot < last) AND (plan_p->wordOffset[slot] != convert_p->sigConfig_p->offByte))
+                {
+                    slot++;
+                }
+
+                if (slot == last)
+                {
+                    /* New word of this message */
+                    plan_p->wordOffset[slot] = convert_p->sigConfig_p->offByte;
+                    plan_p->msgWordCount[msgIdx]++;
+                }
+                else
+                {
+                    /* No action as designed                  */
+                    /* Word already read by another signal    */
+                }
+
+                convert_p->hostSlot = slot;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+            convert_p++;
+        }
+
+        plan_p->nofHostWords = nofWords;
+        plan_p->hostValid    = TRUE;
+    }
+    else
+    {
+        /* No action as designed                          */
+        /* Too many words, signals are swapped when read  */
+    }
+#endif
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epCanonicalizeMessage
+ *
+ * DESCRIPTION:
+ *   This function converts the signal words of one AFDX message to host byte order.
+ *   It is called after each read of the message port.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *   Global Data      :  ioen_inMsgBuffer
+ *
+ *   In:  msgIdx      : index of the AFDX message
+ *
+ ******************************************************************/
+void ioen_epCanonicalizeMessage (
+    /* IN     */ const UInt32_t                     msgIdx
+)
+{
+    UInt32_t                  slot;
+    UInt32_t                  last;
+    InputExecPlan_t          *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+
+    if (    (plan_p->hostOrder == TRUE)
+        AND (plan_p->hostValid == TRUE)
+        AND (msgIdx            <  IOEN_MAX_RX_PORT_NUMBER)
+       )
+    {
+        last = plan_p->msgWordFirst[msgIdx] + plan_p->msgWordCount[msgIdx];
+
+        for (slot = plan_p->msgWordFirst[msgIdx]; slot < last; slot++)
+        {
+            plan_p->hostWord[slot] = NTOH32(*((UInt32_t*)(ioen_inMsgBuffer + plan_p->wordOffset[slot])));
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setHostOrderInput
+ *
+ * DESCRIPTION:
+ *   This function switches the host byte order words of the AFDX messages on or off.
+ *   When switched on, the batch converters read the signal words that were converted once on receive
+ *   (see ioen_epCanonicalizeMessage), instead of swapping the word for each signal.
+ *   Only used with the execution plan, and only on little endian targets.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  enable      : TRUE = convert the signal words on receive, FALSE = swap the word for each signal
+ *
+ ******************************************************************/
+void ioen_setHostOrderInput (
+    /* IN     */ const Bool_t                       enable
+)
+{
+    UInt32_t                  idx;
+    UInt32_t                  msgIdx;
+    ExecPlanConvert_t        *convert_p;
+    InputExecPlan_t          *plan_p;
+
+    plan_p            = &ioen_inputExecPlan;
+    plan_p->hostOrder = enable;
+
+    /* Bring all words up to date with the message buffer */
+    for (msgIdx = 0; msgIdx < IOEN_MAX_RX_PORT_NUMBER; msgIdx++)
+    {
+        ioen_epCanonicalizeMessage (msgIdx);
+    }
+
+    /* Link the signals to their word in host byte order, or let the converters swap */
+    convert_p = plan_p->convert;
+    for (idx = 0; idx < plan_p->nofConverts; idx++)
+    {
+        if (    (plan_p->hostOrder  == TRUE)
+            AND (plan_p->hostValid  == TRUE)
+            AND (convert_p->hostSlot != IOEN_EP_NO_HOST_WORD)
+           )
+        {
+            convert_p->hostWord_p = &plan_p->hostWord[convert_p->hostSlot];
+        }
+        else
+        {
+            convert_p->hostWord_p = NULL_PTR;
+        }
+        convert_p++;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epCompilePlan
+ *
+ * DESCRIPTION:
+ *   This function compiles the execution plan of the AFDX/A429 input processing.
+ *   The confirmation objects must be initialised before (ioen_initializeIom).
+ *   When the configuration does not fit in the plan, the plan stays invalid
+ *   and the configuration is walked every cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *
+ ******************************************************************/
+void ioen_epCompilePlan (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                  type;
+    UInt32_t                  nofConverts;
+    Bool_t                    enabled;
+    Bool_t                    hostOrder;
+    Bool_t                    fits;
+    InputExecPlan_t          *plan_p;
+
+    plan_p = &ioen_inputExecPlan;
+
+    /* Keep the modes requested by the application */
+    enabled   = plan_p->enabled;
+    hostOrder = plan_p->hostOrder;
+
+    memset ((void *) plan_p, 0x00, sizeof(InputExecPlan_t));
+
+    plan_p->enabled   = enabled;
+    plan_p->hostOrder = hostOrder;
+    plan_p->nofSingle = iom_p->afdxInputDatasetCount;
+    plan_p->nofMulti  = iom_p->afdxInputDatasetMultiCount;
+
+    fits = (plan_p->nofSingle + plan_p->nofMulti) <= IOEN_EP_MAX_DATASETS;
+
+    if (fits == TRUE)
+    {
+        /* Count the conversions per input mapping type */
+        fits = ioen_epAddAllDatasets (iom_p, FALSE);
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    if (fits == TRUE)
+    {
+        /* Reserve the conversions of each input mapping type */
+        nofConverts = 0;
+        for (type = 0; type < IOEN_NUMBER_INPUT_MAPPING_TYPES; type++)
+        {
+            plan_p->typeFirst[type] = (UInt16_t)nofConverts;
+            nofConverts            += plan_p->typeCount[type];
+            plan_p->typeCount[type] = 0;
+        }
+        plan_p->nofConverts = 0;
+        plan_p->nofCopies   = 0;
+
+        /* Store the datasets, conversions and parameter routings */
+        fits = ioen_epAddAllDatasets (iom_p, TRUE);
+    }
+    else
+    {
+        /* No action as designed                        */
+        /* Too many datasets, plan stays invalid        */
+    }
+
+    if (fits == TRUE)
+    {
+        fits = ioen_epAddSelections (iom_p);
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    plan_p->valid = fits;
+
+    if (fits == TRUE)
+    {
+        /* Build the host byte order words of the AFDX messages */
+        ioen_epInitHostWords ();
+        ioen_setHostOrderInput (plan_p->hostOrder);
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setExecutionPlan
+ *
+ * DESCRIPTION:
+ *   This function selects the execution plan or the configuration walk for the AFDX/A429 input processing.
+ *   Both produce the same results. When the configuration did not fit in the plan, the configuration walk is used.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  enable      : TRUE = execute the compiled plan, FALSE = walk the configuration
+ *
+ ******************************************************************/
+void ioen_setExecutionPlan (
+    /* IN     */ const Bool_t                       enable
+)
+{
+    ioen_inputExecPlan.enabled = enable;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epConvertAll
+ *
+ * DESCRIPTION:
+ *   This function performs the conversions of all processed datasets from the input message buffer
+ *   to the source buffer. The conversions are performed per input mapping type, using the batch
+ *   converter of the type if there is one, otherwise calling the converter of the type for each signal.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *   Global Data      :  ioen_inputConverters
+ *   Global Data      :  ioen_inputBatchConverters
+ *   Global Data      :  ioen_inMsgBuffer
+ *   Global Data      :  ioen_inParamBufferSrc
+ *
+ ******************************************************************/
+static void ioen_epConvertAll (
+    /*        */       void
+)
+{
+    UInt32_t                  type;
+    UInt32_t                  idx;
+    const ExecPlanConvert_t  *convert_p;
+    const InputExecPlan_t    *plan_p;
+    void                    (*converter)(const Validity_t, const ParamMappingConfig_t *, const InputSignalConfig_t *, const Byte_t *, Byte_t *);
+
+    plan_p = &ioen_inputExecPlan;
+
+    for (type = 0; type < IOEN_NUMBER_INPUT_MAPPING_TYPES; type++)
+    {
+        convert_p = &plan_p->convert[plan_p->typeFirst[type]];
+
+        if (ioen_inputBatchConverters[type] != NULL_PTR)
+        {
+            ioen_inputBatchConverters[type] (convert_p, plan_p->typeCount[type], plan_p->dsActive, ioen_inMsgBuffer, ioen_inParamBufferSrc);
+        }
+        else
+        {
+            converter = ioen_inputConverters[type];
+
+            for (idx = 0; idx < plan_p->typeCount[type]; idx++)
+            {
+                if (plan_p->dsActive[convert_p->dsIdx] == TRUE)
+                {
+                    converter (*convert_p->validity_p, convert_p->parConfig_p, convert_p->sigConfig_p, ioen_inMsgBuffer, ioen_inParamBufferSrc);
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+                convert_p++;
+            }
+        }
+    }
+}
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epCopyDataset
+ *
+ * DESCRIPTION:
+ *   This function routes all parameters of the selected source of a dataset to the application.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *
+ *   In:  planDs_p        : precompiled dataset
+ *   In:  selectedSource  : Selected source in the selection set
+ *   In:  valid_p         : control object for validities of the selected source
+ *
+ ******************************************************************/
+static void ioen_epCopyDataset (
+    /* IN     */ const ExecPlanDataset_t        * const planDs_p,
+    /* IN     */ const UInt32_t                         selectedSource,
+    /* IN     */ const Valid_t                  * const valid_p
+)
+{
+    UInt32_t                  idx;
+    const ExecPlanCopy_t     *copy_p;
+
+    copy_p = &ioen_inputExecPlan.copy[planDs_p->firstCopy];
+
+    for (idx = 0; idx < planDs_p->nofCopies; idx++)
+    {
+        ioen_imaCopyParamToParamBuffer (copy_p->parConfig_p, &copy_p->sigConfig_p[selectedSource], selectedSource, valid_p);
+        copy_p++;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epGetSourceValidity
+ *
+ * DESCRIPTION:
+ *   This function calculates the validity of each source of a dataset, as ioen_ssGetSourceValidity does.
+ *   Each distinct condition is evaluated once per cycle, the result is shared by all sources using it.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *   Global Data      :  ioen_validityChecker
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_inMsgBuffer
+ *
+ *   In:      planDs_p    : precompiled dataset
+ *   In:      numSources  : number of sources of the dataset
+ *   In Out:  ctrl        : array of confirmation control objects
+ *
+ ******************************************************************/
+static void ioen_epGetSourceValidity (
+    /* IN     */ const ExecPlanDataset_t        * const planDs_p,
+    /* IN     */ const UInt32_t                         numSources,
+    /* IN OUT */       IomObjectCtrlData_t              ctrl[IOEN_MAX_SOURCES_PER_INPUT]
+)
+{
+    UInt32_t                  curSource;
+    UInt32_t                  valIdx;
+    Validity_t                validityFinal;
+    const UInt16_t           *condRef_p;
+    ExecPlanCondition_t      *condition_p;
+    InputExecPlan_t          *plan_p;
+
+    plan_p    = &ioen_inputExecPlan;
+    condRef_p = &plan_p->condRef[planDs_p->firstCondRef];
+
+    for (curSource = 0; (curSource < numSources); curSource++)
+    {
+        validityFinal.spare          = 0;
+        validityFinal.selectedSource = 0;
+        validityFinal.value          = IOEN_GLOB_DATA_INIT_VALUE;
+        validityFinal.ifValue        = IOEN_VALIDITY_NODATA;
+
+        for (valIdx = 0; (valIdx < planDs_p->validityLogic_p[curSource].numConditions); valIdx++)
+        {
+            condition_p = &plan_p->condition[*condRef_p];
+            condRef_p++;
+
+            if (condition_p->cycle != plan_p->condCycle)
+            {
+                /* First use of the condition in this cycle */
+                condition_p->validity = ioen_validityChecker[condition_p->conditionType](ioen_inMsgBuffer, condition_p->condition_p);
+                condition_p->cycle    = plan_p->condCycle;
+            }
+            else
+            {
+                /* No action as designed                      */
+                /* Condition already evaluated in this cycle  */
+            }
+
+            ioen_ssCombineValidity (&validityFinal, condition_p->validity);
+        }
+
+        /* Save validity for later rounting of the data.  */
+        ctrl[curSource].validity.current = validityFinal;
+
+        /* Check all validities for the health score source.  */
+        if (validityFinal.value == IOEN_GLOB_DATA_VALID)
+        {
+            /* If the source is valid, update the health score for the current Set/Source */
+            ioen_selectionSetlist[planDs_p->validityLogic_p->sourceSet].healthScore[curSource]++;
+        }
+        else
+        {
+            /* No action as designed                            */
+            /* Do not increase health score for invalid objects */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_epProcessInput
+ *
+ * DESCRIPTION:
+ *   This function executes the compiled plan of the AFDX/A429 input processing:
+ *     1. Validity of each source of all datasets that are processed, each distinct condition evaluated once
+ *     2. Conversion of all signals of these datasets, grouped per input mapping type
+ *     3. Confirmation, and routing to the application of the single source datasets
+ *     4. Source selection of all selection sets, or only the changed sets (see ioen_ssCollectSets)
+ *     5. Multiple source datasets: routing of the selected source to the application
+ *   The conversions of the datasets are independent of each other, so grouping them per type
+ *   produces the same results as the configuration walk.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputExecPlan
+ *   Global Data      :  ioen_inObjectCtrl
+ *   Global Data      :  ioen_inParamBufferSrc
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ ******************************************************************/
+void ioen_epProcessInput (
+    /*        */       void
+)
+{
+    UInt32_t                  idx;
+    UInt32_t                  dsIdx;
+    UInt32_t                  nofDatasets;
+    UInt32_t                  selectedSource;
+    Bool_t                    singleSource;
+    const ExecPlanDataset_t  *planDs_p;
+    const ExecPlanSelection_t *selection_p;
+    const IOMConfigHeader_t  *iom_p;
+    InputExecPlan_t          *plan_p;
+
+    iom_p       = ioen_iomConfig_p;
+    plan_p      = &ioen_inputExecPlan;
+    nofDatasets = plan_p->nofSingle + plan_p->nofMulti;
+
+    /* New cycle of the condition cache, 0 is reserved for conditions never evaluated */
+    plan_p->condCycle++;
+    if (plan_p->condCycle == 0)
+    {
+        plan_p->condCycle = 1;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    /* Get the validities of all datasets that are processed in this cycle */
+    for (dsIdx = 0; dsIdx < nofDatasets; dsIdx++)
+    {
+        planDs_p     = &plan_p->dataset[dsIdx];
+        singleSource = (dsIdx < plan_p->nofSingle);
+
+        if (ioen_incSkipDataset (dsIdx, planDs_p->dataset_p, singleSource, ioen_inObjectCtrl[dsIdx]) == TRUE)
+        {
+            /* Dataset unchanged since it was last processed  */
+            plan_p->dsActive[dsIdx] = FALSE;
+        }
+        else
+        {
+            plan_p->dsActive[dsIdx] = TRUE;
+        }
+
+        if (plan_p->dsActive[dsIdx] == FALSE)
+        {
+            /* No action as designed */
+        }
+        else if (singleSource == FALSE)
+        {
+            ioen_epGetSourceValidity (planDs_p, planDs_p->dataset_p->numSources, ioen_inObjectCtrl[dsIdx]);
+        }
+        else if (planDs_p->dataset_p->numSources == 0)
+        {
+            /* Internal parameter, just set status to valid */
+            if (planDs_p->nofCopies > 0)
+            {
+                *(UInt32_t *)(ioen_inParamBufferSrc + plan_p->copy[planDs_p->firstCopy].sigConfig_p->valOffset) = IOEN_VALIDITY_NORMALOP;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+        }
+        else if (planDs_p->dataset_p->numSources == 1)
+        {
+            ioen_epGetSourceValidity (planDs_p, 1, ioen_inObjectCtrl[dsIdx]);
+        }
+        else
+        {
+            /* No Action, as designed */
+            /* Robustnest case for in valid number of sources */
+        }
+    }
+
+    /* Convert the signals of all processed datasets */
+    ioen_epConvertAll ();
+
+    /* Confirm all processed datasets, and route the single source datasets to the application */
+    for (dsIdx = 0; dsIdx < nofDatasets; dsIdx++)
+    {
+        planDs_p = &plan_p->dataset[dsIdx];
+
+        if (plan_p->dsActive[dsIdx] == FALSE)
+        {
+            /* No action as designed */
+        }
+        else if (dsIdx >= plan_p->nofSingle)
+        {
+            ioen_ConfirmObjectValidity (planDs_p->dataset_p->numSources, ioen_inObjectCtrl[dsIdx]);
+        }
+        else if (planDs_p->dataset_p->numSources == 1)
+        {
+            ioen_ConfirmObjectValidity (1, ioen_inObjectCtrl[dsIdx]);
+
+            ioen_epCopyDataset (planDs_p, 0, &ioen_inObjectCtrl[dsIdx][0].validity);
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+
+    if (ioen_ssCollectSets () == TRUE)
+    {
+        /* Change driven selection, only the sets that changed or are still confirming */
+        ioen_ssCalcListedSets (iom_p);
+        ioen_ssPerformListedSets (iom_p);
+    }
+    else
+    {
+        /* Calculate any source selection objects that are only associated with a set (not an output parameter) */
+        selection_p = plan_p->selection;
+        for (idx = 0; idx < plan_p->nofSelections; idx++)
+        {
+            if (selection_p->setConfig_p->criteria == IOEN_OBJECT_VALID)
+            {
+                ioen_ssCalcSetObjects (iom_p, selection_p->curSet, selection_p->setConfig_p);
+            }
+            else
+            {
+                /* No action as designed                                     */
+                /* There are only extra validity parameters for OBJECT_VALID */
+            }
+            selection_p++;
+        }
+
+        /* Select a source for each selection set */
+        selection_p = plan_p->selection;
+        for (idx = 0; idx < plan_p->nofSelections; idx++)
+        {
+            ioen_ssPerformSetSelection (iom_p, selection_p->curSet, selection_p->setConfig_p);
+            selection_p++;
+        }
+    }
+
+    /* Using the selected sources, route to application, all datasets with multiple sources */
+    for (dsIdx = plan_p->nofSingle; dsIdx < nofDatasets; dsIdx++)
+    {
+        planDs_p = &plan_p->dataset[dsIdx];
+
+        if (ioen_incSkipDatasetValue (dsIdx, planDs_p->dataset_p) == FALSE)
+        {
+            selectedSource = ioen_selectionSetlist[planDs_p->validityLogic_p->sourceSet].selectedSource;
+
+            ioen_epCopyDataset (planDs_p, selectedSource, &ioen_inObjectCtrl[dsIdx][selectedSource].validity);
+        }
+        else
+        {
+            /* No action as designed                                  */
+            /* Dataset unchanged and same source selected             */
+        }
+    }
+}
@@ -0,0 +1,423 @@
+/***************************************************************
+ * COPYRIGHT:
+ *   2013-2015
+ *   Chinese Aeronautical Radio Electronics Research Institute
+ *   All Rights Reserved
+ *
+ * FILE NAME:
+ *   ioen_Freshness.c
+ *
+ * FILE DESCRIPTION:
+ *   This module calculates the freshness of the input messages with deadlines.
+ *   Each message stores the cycle in which it becomes unfresh. The messages that are
+ *   still fresh are kept in a timing wheel, indexed by their deadline.
+ *   A cycle only touches the messages received in the cycle and the messages
+ *   whose slot is due, instead of counting down every configured message.
+ *
+***************************************************************/
+
+
+#include "ioen_IomLocal.h"
+
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frUnlink
+ *
+ * DESCRIPTION:
+ *   This function removes a fresh message from the slot of its deadline.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p : Freshness wheel
+ *   In:      idx     : Index of the message
+ *
+ ******************************************************************/
+static void ioen_frUnlink (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+)
+{
+    MsgDeadline_t      *entry_p;
+
+    entry_p = &wheel_p->entry_p[idx];
+
+    if (entry_p->prev == IOEN_FRESH_END)
+    {
+        /* First message of the slot */
+        wheel_p->slotFirst[entry_p->deadline % IOEN_FRESH_WHEEL_SIZE] = entry_p->next;
+    }
+    else
+    {
+        wheel_p->entry_p[entry_p->prev].next = entry_p->next;
+    }
+
+    if (entry_p->next != IOEN_FRESH_END)
+    {
+        wheel_p->entry_p[entry_p->next].prev = entry_p->prev;
+    }
+    else
+    {
+        /* No action as designed, last message of the slot */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frLink
+ *
+ * DESCRIPTION:
+ *   This function sets a new deadline of a message and adds it to the slot of the deadline.
+ *   Deadlines further away than one turn of the wheel stay in their slot until the turn
+ *   in which they are due.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p  : Freshness wheel
+ *   In:      idx      : Index of the message
+ *   In:      deadline : Cycle in which the message becomes unfresh
+ *
+ ******************************************************************/
+static void ioen_frLink (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx,
+    /* IN     */ const UInt32_t                   deadline
+)
+{
+    UInt32_t            slot;
+    MsgDeadline_t      *entry_p;
+
+    entry_p = &wheel_p->entry_p[idx];
+    slot    = deadline % IOEN_FRESH_WHEEL_SIZE;
+
+    entry_p->deadline = deadline;
+    entry_p->expired  = FALSE;
+    entry_p->prev     = IOEN_FRESH_END;
+    entry_p->next     = wheel_p->slotFirst[slot];
+
+    if (entry_p->next != IOEN_FRESH_END)
+    {
+        wheel_p->entry_p[entry_p->next].prev = (UInt16_t)idx;
+    }
+    else
+    {
+        /* No action as designed, slot was empty */
+    }
+
+    wheel_p->slotFirst[slot] = (UInt16_t)idx;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frInitWheel
+ *
+ * DESCRIPTION:
+ *   This function initialises an empty freshness wheel.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p    : Freshness wheel
+ *   In:      entry_p    : Deadline per message, one entry per message
+ *   In:      event_p    : Event list, one entry per message
+ *   In:      maxEntries : Number of entries of entry_p and event_p
+ *
+ ******************************************************************/
+void ioen_frInitWheel (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */       MsgDeadline_t      * const entry_p,
+    /* IN     */       UInt16_t           * const event_p,
+    /* IN     */ const UInt32_t                   maxEntries
+)
+{
+    UInt32_t            slot;
+
+    wheel_p->cycle      = 0;
+    wheel_p->nofEntries = 0;
+    wheel_p->maxEntries = maxEntries;
+    wheel_p->nofEvents  = 0;
+    wheel_p->entry_p    = entry_p;
+    wheel_p->event_p    = event_p;
+
+    for (slot = 0; slot < IOEN_FRESH_WHEEL_SIZE; slot++)
+    {
+        wheel_p->slotFirst[slot] = IOEN_FRESH_END;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frInitEntry
+ *
+ * DESCRIPTION:
+ *   This function initialises the deadline of one message, once after ioen_frInitWheel.
+ *   The message is due in the current cycle, this forces an initial unfresh transition.
+ *   The timeout is not limited to 255 cycles.
+ *   A message beyond the size of the wheel is rejected, it stays unfresh.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p     : Freshness wheel
+ *   In:      idx         : Index of the message
+ *   In:      unfreshTime : Max duration, before a message is marked as unfresh in ms
+ *   In:      appPeriodMs : Periodic time of process in millisecs
+ *
+ ******************************************************************/
+void ioen_frInitEntry (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx,
+    /* IN     */ const UInt32_t                   unfreshTime,
+    /* IN     */ const Float32_t                  appPeriodMs
+)
+{
+    MsgDeadline_t      *entry_p;
+
+    if (idx < wheel_p->maxEntries)
+    {
+        entry_p = &wheel_p->entry_p[idx];
+
+        if (idx >= wheel_p->nofEntries)
+        {
+            wheel_p->nofEntries = idx + 1;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+
+        entry_p->limitCycle = (UInt32_t)( ((Float32_t)unfreshTime / appPeriodMs) + 0.99); /* plus 0,99 for rounding up */
+        entry_p->limitCycle++;  /* plus 1 because the cycle of the reception is not counted */
+        entry_p->received   = FALSE;
+
+        ioen_frLink (wheel_p, idx, wheel_p->cycle);
+    }
+    else
+    {
+        /* No action as designed, message can not be stored in the wheel */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frNewData
+ *
+ * DESCRIPTION:
+ *   This function signals that a message has been received in the current cycle.
+ *   The message is fresh from the next ioen_frUpdate on.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p : Freshness wheel
+ *   In:      idx     : Index of the message
+ *
+ ******************************************************************/
+void ioen_frNewData (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+)
+{
+    if (idx >= wheel_p->nofEntries)
+    {
+        /* No action as designed, message not in the wheel */
+    }
+    else if (wheel_p->entry_p[idx].received == FALSE)
+    {
+        wheel_p->entry_p[idx].received           = TRUE;
+        wheel_p->event_p[wheel_p->nofEvents]     = (UInt16_t)idx;
+        wheel_p->nofEvents++;
+    }
+    else
+    {
+        /* No action as designed, already received in this cycle */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frRearm
+ *
+ * DESCRIPTION:
+ *   This function makes a message fresh immediately, without an event.
+ *   The check of the current cycle counts as the first cycle of the timeout.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p : Freshness wheel
+ *   In:      idx     : Index of the message
+ *
+ ******************************************************************/
+void ioen_frRearm (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+)
+{
+    if (idx < wheel_p->nofEntries)
+    {
+        if (wheel_p->entry_p[idx].expired == FALSE)
+        {
+            ioen_frUnlink (wheel_p, idx);
+        }
+        else
+        {
+            /* No action as designed, message not in the wheel */
+        }
+
+        ioen_frLink (wheel_p, idx, (wheel_p->cycle + wheel_p->entry_p[idx].limitCycle) - 1);
+    }
+    else
+    {
+        /* No action as designed, message not in the wheel */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frIsExpired
+ *
+ * DESCRIPTION:
+ *   This function returns if a message is unfresh, a message not in the wheel is unfresh.
+ *
+ * INTERFACE:
+ *
+ *   In:  wheel_p : Freshness wheel
+ *   In:  idx     : Index of the message
+ *
+ *   Return : TRUE if the message is unfresh
+ *
+ ******************************************************************/
+Bool_t ioen_frIsExpired (
+    /* IN     */ const FreshnessWheel_t   * const wheel_p,
+    /* IN     */ const UInt32_t                   idx
+)
+{
+    Bool_t  expired;
+
+    if (idx < wheel_p->nofEntries)
+    {
+        expired = wheel_p->entry_p[idx].expired;
+    }
+    else
+    {
+        /* Message not in the wheel, never fresh */
+        expired = TRUE;
+    }
+
+    return expired;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frUpdate
+ *
+ * DESCRIPTION:
+ *   This function ends the cycle of a freshness wheel.
+ *   The messages received in the cycle become fresh until (cycle + limitCycle),
+ *   then the messages due in this cycle become unfresh.
+ *   Afterwards event_p[0..nofEvents-1] lists the messages that were received or became unfresh,
+ *   the new state is given by ioen_frIsExpired.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p : Freshness wheel
+ *
+ ******************************************************************/
+void ioen_frUpdate (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p
+)
+{
+    UInt32_t            evIdx;
+    UInt32_t            idx;
+    UInt32_t            nextIdx;
+    MsgDeadline_t      *entry_p;
+
+    /* Received messages, the events are already in the list */
+    for (evIdx = 0; evIdx < wheel_p->nofEvents; evIdx++)
+    {
+        idx     = wheel_p->event_p[evIdx];
+        entry_p = &wheel_p->entry_p[idx];
+
+        if (entry_p->expired == FALSE)
+        {
+            ioen_frUnlink (wheel_p, idx);
+        }
+        else
+        {
+            /* No action as designed, message not in the wheel */
+        }
+
+        entry_p->received = FALSE;
+        ioen_frLink (wheel_p, idx, wheel_p->cycle + entry_p->limitCycle);
+    }
+
+    /* Messages due in this slot, deadlines of a later turn stay in the slot */
+    if (wheel_p->nofEntries > 0)
+    {
+        idx = wheel_p->slotFirst[wheel_p->cycle % IOEN_FRESH_WHEEL_SIZE];
+    }
+    else
+    {
+        /* Transport not configured, the wheel is not initialised */
+        idx = IOEN_FRESH_END;
+    }
+
+    while (idx != IOEN_FRESH_END)
+    {
+        entry_p = &wheel_p->entry_p[idx];
+        nextIdx = entry_p->next;
+
+        if (entry_p->deadline == wheel_p->cycle)
+        {
+            /* Confirmed unfresh message */
+            ioen_frUnlink (wheel_p, idx);
+            entry_p->expired = TRUE;
+
+            wheel_p->event_p[wheel_p->nofEvents] = (UInt16_t)idx;
+            wheel_p->nofEvents++;
+        }
+        else
+        {
+            /* No action as designed            */
+            /* Due in a later turn of the wheel */
+        }
+
+        idx = nextIdx;
+    }
+
+    wheel_p->cycle++;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_frClearEvents
+ *
+ * DESCRIPTION:
+ *   This function clears the event list, after the events of ioen_frUpdate were handled.
+ *
+ * INTERFACE:
+ *
+ *   In Out:  wheel_p : Freshness wheel
+ *
+ ******************************************************************/
+void ioen_frClearEvents (
+    /* IN OUT */       FreshnessWheel_t   * const wheel_p
+)
+{
+    wheel_p->nofEvents = 0;
+}
@@ -160,25 +160,28 @@ void ioen_icA664String (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_ic32bUInt
+ *   ioen_icCore32bUInt
  *
  * DESCRIPTION:
- *   This function reads a 32bits Unsigned Integer from the Input Message Buffer and copies it into the Parameter Buffer
- *   The parameter validity is copied into the Parameter Buffer
+ *   This function converts a 32bits Unsigned Integer of one signal.
+ *   It is the conversion of ioen_ic32bUInt and of the batch loop, the signal word is read from the
+ *   Input Message Buffer, or taken from hostWord_p when it was converted to host byte order on receive.
  *
  * INTERFACE:
  *
  *   In:  validity      : Calculated validity based on configured validities
  *   In:  parConfig_p   : Parameter Config
  *   In:  sigConfig_p   : Input Signal Config
+ *   In:  hostWord_p    : Signal word in host byte order, or NULL_PTR
  *   In:  inMsgBuffer   : Input message buffer
  *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
  *
  ******************************************************************/
-void ioen_ic32bUInt (
+static void ioen_icCore32bUInt (
     /* IN     */ const Validity_t                   validity,
     /* IN     */ const ParamMappingConfig_t * const parConfig_p,
     /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const UInt32_t             * const hostWord_p,
     /* IN     */ const Byte_t               * const inMsgBuffer,
     /* IN     */       Byte_t               * const inParamBufferSrc
 )
@@ -188,8 +191,16 @@ void ioen_ic32bUInt (
     /* Check input validity */
     if (validity.value == IOEN_GLOB_DATA_VALID)
     {
-        data = *((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte));
-        data = NTOH32(data);
+        if (hostWord_p != NULL_PTR)
+        {
+            /* Word already converted to host byte order on receive */
+            data = *hostWord_p;
+        }
+        else
+        {
+            data = *((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte));
+            data = NTOH32(data);
+        }
 
         *((UInt32_t*)(inParamBufferSrc + sigConfig_p->parOffset)) = data;
     }
@@ -201,16 +212,16 @@ void ioen_ic32bUInt (
 
     /* Store parameter Validity */
     *(UInt32_t *)(inParamBufferSrc + sigConfig_p->valOffset) = * ((UInt32_t *) &validity);
-
 }
 
 
+
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_ic32bInt
+ *   ioen_ic32bUInt
  *
  * DESCRIPTION:
- *   This function reads a 32bits Signed Integer from the Input Message Buffer and copies it into the Parameter Buffer
+ *   This function reads a 32bits Unsigned Integer from the Input Message Buffer and copies it into the Parameter Buffer
  *   The parameter validity is copied into the Parameter Buffer
  *
  * INTERFACE:
@@ -222,10 +233,42 @@ void ioen_ic32bUInt (
  *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
  *
  ******************************************************************/
-void ioen_ic32bInt (
+void ioen_ic32bUInt (
+    /* IN     */ const Validity_t                   validity,
+    /* IN     */ const ParamMappingConfig_t * const parConfig_p,
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    ioen_icCore32bUInt (validity, parConfig_p, sigConfig_p, NULL_PTR, inMsgBuffer, inParamBufferSrc);
+}
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icCore32bInt
+ *
+ * DESCRIPTION:
+ *   This function converts a scaled 32bits Signed Integer of one signal.
+ *   It is the conversion of ioen_ic32bInt and of the batch loop, the signal word is read from the
+ *   Input Message Buffer, or taken from hostWord_p when it was converted to host byte order on receive.
+ *
+ * INTERFACE:
+ *
+ *   In:  validity      : Calculated validity based on configured validities
+ *   In:  parConfig_p   : Parameter Config
+ *   In:  sigConfig_p   : Input Signal Config
+ *   In:  hostWord_p    : Signal word in host byte order, or NULL_PTR
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+static void ioen_icCore32bInt (
     /* IN     */ const Validity_t                   validity,
     /* IN     */ const ParamMappingConfig_t * const parConfig_p,
     /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const UInt32_t             * const hostWord_p,
     /* IN     */ const Byte_t               * const inMsgBuffer,
     /* IN     */       Byte_t               * const inParamBufferSrc
 )
@@ -236,8 +279,16 @@ void ioen_ic32bInt (
     /* Check input validity */
     if (validity.value == IOEN_GLOB_DATA_VALID)
     {
-        data  = *((SInt32_t*)(inMsgBuffer + sigConfig_p->offByte));   /* Read raw data */
-        value =  NTOH32(data) * sigConfig_p->lsbValue;                 /* Scaling */
+        if (hostWord_p != NULL_PTR)
+        {
+            /* Word already converted to host byte order on receive (same type as NTOH32) */
+            value = *hostWord_p * sigConfig_p->lsbValue;                   /* Scaling */
+        }
+        else
+        {
+            data  = *((SInt32_t*)(inMsgBuffer + sigConfig_p->offByte));   /* Read raw data */
+            value =  NTOH32(data) * sigConfig_p->lsbValue;                 /* Scaling */
+        }
 
         *((SInt32_t*)(inParamBufferSrc + sigConfig_p->parOffset)) = (SInt32_t)value;
     }
@@ -249,7 +300,36 @@ void ioen_ic32bInt (
 
     /* Store parameter Validity */
     *(UInt32_t *)(inParamBufferSrc + sigConfig_p->valOffset) = * ((UInt32_t *) &validity);
+}
+
 
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ic32bInt
+ *
+ * DESCRIPTION:
+ *   This function reads a 32bits Signed Integer from the Input Message Buffer and copies it into the Parameter Buffer
+ *   The parameter validity is copied into the Parameter Buffer
+ *
+ * INTERFACE:
+ *
+ *   In:  validity      : Calculated validity based on configured validities
+ *   In:  parConfig_p   : Parameter Config
+ *   In:  sigConfig_p   : Input Signal Config
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_ic32bInt (
+    /* IN     */ const Validity_t                   validity,
+    /* IN     */ const ParamMappingConfig_t * const parConfig_p,
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    ioen_icCore32bInt (validity, parConfig_p, sigConfig_p, NULL_PTR, inMsgBuffer, inParamBufferSrc);
 }
 
 
@@ -941,40 +1021,28 @@ void ioen_ic32bData_Float2Int (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_icA429BNR
+ *   ioen_icCoreA429BNR
  *
  * DESCRIPTION:
- *   Convert Signed BNR label into floating point value
- *   The parameter validity is copied into the Parameter Buffer
- *
- *    Mask out significant bits and multiply with lsbValue
- *    if bit 28==1, result is negative, and data is in twos complement
- *
- * ----------------------------------------------------------------------------------------------
- * |31 | 30 | 29 | 28 | 27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10 | 9 | 8 | 7 ... 0 |
- * |--------------------------------------------------------------------------------------------|
- * | P |   SSM   | S  |                  Data                                 |  SDI  |  Label  |
- * ----------------------------------------------------------------------------------------------
- *
- * P     = Parity=Odd parity
- * SSM   = Sign Status Matrix, 00= Failure Waring, 01=No computed Data, 10=Functional Test, 11=Normal Operation
- * S     = sign, 0= Positive, 1=negative
- * SDI   = Source / Destination Identifier
- * Label = 8 bit label ID, usually specified in Octal
+ *   This function converts the A429 BNR label of one signal into a floating point value.
+ *   It is the conversion of ioen_icA429BNR and of the batch loop, the signal word is read from the
+ *   Input Message Buffer, or taken from hostWord_p when it was converted to host byte order on receive.
  *
  * INTERFACE:
  *
  *   In:  validity      : Calculated validity based on configured validities
  *   In:  parConfig_p   : Parameter Config
  *   In:  sigConfig_p   : Input Signal Config
+ *   In:  hostWord_p    : Signal word in host byte order, or NULL_PTR
  *   In:  inMsgBuffer   : Input message buffer
  *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
  *
  ******************************************************************/
-void ioen_icA429BNR (
+static void ioen_icCoreA429BNR (
     /* IN     */ const Validity_t                   validity,
     /* IN     */ const ParamMappingConfig_t * const parConfig_p,
     /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const UInt32_t             * const hostWord_p,
     /* IN     */ const Byte_t               * const inMsgBuffer,
     /* IN     */       Byte_t               * const inParamBufferSrc
 )
@@ -987,7 +1055,15 @@ void ioen_icA429BNR (
     /* Check input validity */
     if (validity.value == IOEN_GLOB_DATA_VALID)
     {
-        a429word = NTOH32(*((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte)));
+        if (hostWord_p != NULL_PTR)
+        {
+            /* Word already converted to host byte order on receive */
+            a429word = *hostWord_p;
+        }
+        else
+        {
+            a429word = NTOH32(*((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte)));
+        }
         ivalue   = ((a429word BIT_AND 0x1FFFFFFF) BIT_RSHIFT sigConfig_p->offBits) BIT_AND ((1 BIT_LSHIFT (sigConfig_p->sizeBits)) - 1);
 
         if (((a429word BIT_RSHIFT 28) BIT_AND 1) == 1)
@@ -1014,7 +1090,51 @@ void ioen_icA429BNR (
 
     /* Store parameter Validity */
     *(UInt32_t *)(inParamBufferSrc + sigConfig_p->valOffset) = * ((UInt32_t *) &validity);
+}
 
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icA429BNR
+ *
+ * DESCRIPTION:
+ *   Convert Signed BNR label into floating point value
+ *   The parameter validity is copied into the Parameter Buffer
+ *
+ *    Mask out significant bits and multiply with lsbValue
+ *    if bit 28==1, result is negative, and data is in twos complement
+ *
+ * ----------------------------------------------------------------------------------------------
+ * |31 | 30 | 29 | 28 | 27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10 | 9 | 8 | 7 ... 0 |
+ * |--------------------------------------------------------------------------------------------|
+ * | P |   SSM   | S  |                  Data                                 |  SDI  |  Label  |
+ * ----------------------------------------------------------------------------------------------
+ *
+ * P     = Parity=Odd parity
+ * SSM   = Sign Status Matrix, 00= Failure Waring, 01=No computed Data, 10=Functional Test, 11=Normal Operation
+ * S     = sign, 0= Positive, 1=negative
+ * SDI   = Source / Destination Identifier
+ * Label = 8 bit label ID, usually specified in Octal
+ *
+ * INTERFACE:
+ *
+ *   In:  validity      : Calculated validity based on configured validities
+ *   In:  parConfig_p   : Parameter Config
+ *   In:  sigConfig_p   : Input Signal Config
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icA429BNR (
+    /* IN     */ const Validity_t                   validity,
+    /* IN     */ const ParamMappingConfig_t * const parConfig_p,
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    ioen_icCoreA429BNR (validity, parConfig_p, sigConfig_p, NULL_PTR, inMsgBuffer, inParamBufferSrc);
 }
 
 
@@ -1101,27 +1221,28 @@ void ioen_icA429BNR_Float2Int (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_icA429UBNR
+ *   ioen_icCoreA429UBNR
  *
  * DESCRIPTION:
- *   Convert Unsigned BNR label into floating point value
- *   The parameter validity is copied into the Parameter Buffer
- *
- *    Mask out significant bits and multiply with lsbValue
+ *   This function converts the A429 UBNR label of one signal into a floating point value.
+ *   It is the conversion of ioen_icA429UBNR and of the batch loop, the signal word is read from the
+ *   Input Message Buffer, or taken from hostWord_p when it was converted to host byte order on receive.
  *
  * INTERFACE:
  *
  *   In:  validity      : Calculated validity based on configured validities
  *   In:  parConfig_p   : Parameter Config
  *   In:  sigConfig_p   : Input Signal Config
+ *   In:  hostWord_p    : Signal word in host byte order, or NULL_PTR
  *   In:  inMsgBuffer   : Input message buffer
  *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
  *
  ******************************************************************/
-void ioen_icA429UBNR (
+static void ioen_icCoreA429UBNR (
     /* IN     */ const Validity_t                   validity,
     /* IN     */ const ParamMappingConfig_t * const parConfig_p,
     /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const UInt32_t             * const hostWord_p,
     /* IN     */ const Byte_t               * const inMsgBuffer,
     /* IN     */       Byte_t               * const inParamBufferSrc
 )
@@ -1133,7 +1254,15 @@ void ioen_icA429UBNR (
     /* Check input validity */
     if (validity.value == IOEN_GLOB_DATA_VALID)
     {
-        a429word = NTOH32(*((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte)));
+        if (hostWord_p != NULL_PTR)
+        {
+            /* Word already converted to host byte order on receive */
+            a429word = *hostWord_p;
+        }
+        else
+        {
+            a429word = NTOH32(*((UInt32_t*)(inMsgBuffer + sigConfig_p->offByte)));
+        }
         ivalue   = (a429word >> sigConfig_p->offBits) & ((1 << sigConfig_p->sizeBits) - 1);
         value    = ivalue * sigConfig_p->lsbValue;
 
@@ -1147,7 +1276,38 @@ void ioen_icA429UBNR (
 
     /* Store parameter Validity */
     *(UInt32_t *)(inParamBufferSrc + sigConfig_p->valOffset) = * ((UInt32_t *) &validity);
+}
 
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icA429UBNR
+ *
+ * DESCRIPTION:
+ *   Convert Unsigned BNR label into floating point value
+ *   The parameter validity is copied into the Parameter Buffer
+ *
+ *    Mask out significant bits and multiply with lsbValue
+ *
+ * INTERFACE:
+ *
+ *   In:  validity      : Calculated validity based on configured validities
+ *   In:  parConfig_p   : Parameter Config
+ *   In:  sigConfig_p   : Input Signal Config
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icA429UBNR (
+    /* IN     */ const Validity_t                   validity,
+    /* IN     */ const ParamMappingConfig_t * const parConfig_p,
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    ioen_icCoreA429UBNR (validity, parConfig_p, sigConfig_p, NULL_PTR, inMsgBuffer, inParamBufferSrc);
 }
 
 
@@ -1694,6 +1854,198 @@ void ioen_icMsgUnfresh (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icBatch32bUInt
+ *
+ * DESCRIPTION:
+ *   This function converts a 32bits Unsigned Integer for all signals of this type in one loop.
+ *   The conversion is shared with ioen_ic32bUInt, signals of datasets not processed in this cycle are skipped.
+ *
+ * INTERFACE:
+ *
+ *   In:  convert_p     : Conversions of this input mapping type
+ *   In:  nofConverts   : Number of conversions
+ *   In:  dsActive      : Dataset processed in this cycle, per dataset
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icBatch32bUInt (
+    /* IN     */ const ExecPlanConvert_t    * const convert_p,
+    /* IN     */ const UInt32_t                     nofConverts,
+    /* IN     */ const Byte_t               * const dsActive,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    UInt32_t                    idx;
+
+    for (idx = 0; idx < nofConverts; idx++)
+    {
+        if (dsActive[convert_p[idx].dsIdx] == TRUE)
+        {
+            ioen_icCore32bUInt (*convert_p[idx].validity_p,
+                                convert_p[idx].parConfig_p,
+                                convert_p[idx].sigConfig_p,
+                                convert_p[idx].hostWord_p,
+                                inMsgBuffer,
+                                inParamBufferSrc);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset not processed in this cycle            */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icBatch32bInt
+ *
+ * DESCRIPTION:
+ *   This function converts a scaled 32bits Signed Integer for all signals of this type in one loop.
+ *   The conversion is shared with ioen_ic32bInt, signals of datasets not processed in this cycle are skipped.
+ *
+ * INTERFACE:
+ *
+ *   In:  convert_p     : Conversions of this input mapping type
+ *   In:  nofConverts   : Number of conversions
+ *   In:  dsActive      : Dataset processed in this cycle, per dataset
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icBatch32bInt (
+    /* IN     */ const ExecPlanConvert_t    * const convert_p,
+    /* IN     */ const UInt32_t                     nofConverts,
+    /* IN     */ const Byte_t               * const dsActive,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    UInt32_t                    idx;
+
+    for (idx = 0; idx < nofConverts; idx++)
+    {
+        if (dsActive[convert_p[idx].dsIdx] == TRUE)
+        {
+            ioen_icCore32bInt (*convert_p[idx].validity_p,
+                               convert_p[idx].parConfig_p,
+                               convert_p[idx].sigConfig_p,
+                               convert_p[idx].hostWord_p,
+                               inMsgBuffer,
+                               inParamBufferSrc);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset not processed in this cycle            */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icBatchA429BNR
+ *
+ * DESCRIPTION:
+ *   This function converts an A429 BNR label for all signals of this type in one loop.
+ *   The conversion is shared with ioen_icA429BNR, signals of datasets not processed in this cycle are skipped.
+ *
+ * INTERFACE:
+ *
+ *   In:  convert_p     : Conversions of this input mapping type
+ *   In:  nofConverts   : Number of conversions
+ *   In:  dsActive      : Dataset processed in this cycle, per dataset
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icBatchA429BNR (
+    /* IN     */ const ExecPlanConvert_t    * const convert_p,
+    /* IN     */ const UInt32_t                     nofConverts,
+    /* IN     */ const Byte_t               * const dsActive,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    UInt32_t                    idx;
+
+    for (idx = 0; idx < nofConverts; idx++)
+    {
+        if (dsActive[convert_p[idx].dsIdx] == TRUE)
+        {
+            ioen_icCoreA429BNR (*convert_p[idx].validity_p,
+                                convert_p[idx].parConfig_p,
+                                convert_p[idx].sigConfig_p,
+                                convert_p[idx].hostWord_p,
+                                inMsgBuffer,
+                                inParamBufferSrc);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset not processed in this cycle            */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_icBatchA429UBNR
+ *
+ * DESCRIPTION:
+ *   This function converts an A429 UBNR label for all signals of this type in one loop.
+ *   The conversion is shared with ioen_icA429UBNR, signals of datasets not processed in this cycle are skipped.
+ *
+ * INTERFACE:
+ *
+ *   In:  convert_p     : Conversions of this input mapping type
+ *   In:  nofConverts   : Number of conversions
+ *   In:  dsActive      : Dataset processed in this cycle, per dataset
+ *   In:  inMsgBuffer   : Input message buffer
+ *   In:  inParamBufferSrc : Parameter buffer where the converted input signals are written to
+ *
+ ******************************************************************/
+void ioen_icBatchA429UBNR (
+    /* IN     */ const ExecPlanConvert_t    * const convert_p,
+    /* IN     */ const UInt32_t                     nofConverts,
+    /* IN     */ const Byte_t               * const dsActive,
+    /* IN     */ const Byte_t               * const inMsgBuffer,
+    /* IN     */       Byte_t               * const inParamBufferSrc
+)
+{
+    UInt32_t                    idx;
+
+    for (idx = 0; idx < nofConverts; idx++)
+    {
+        if (dsActive[convert_p[idx].dsIdx] == TRUE)
+        {
+            ioen_icCoreA429UBNR (*convert_p[idx].validity_p,
+                                 convert_p[idx].parConfig_p,
+                                 convert_p[idx].sigConfig_p,
+                                 convert_p[idx].hostWord_p,
+                                 inMsgBuffer,
+                                 inParamBufferSrc);
+        }
+        else
+        {
+            /* No action as designed                          */
+            /* Dataset not processed in this cycle            */
+        }
+    }
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_icInitInputConverter
@@ -0,0 +1,606 @@
+/***************************************************************
+ * COPYRIGHT:
+ *   2013-2015
+ *   Chinese Aeronautical Radio Electronics Research Institute
+ *   All Rights Reserved
+ *
+ * FILE NAME:
+ *   ioen_InputIncremental.c
+ *
+ * FILE DESCRIPTION:
+ *   This module decides which AFDX/A429 input datasets must be processed in a cycle.
+ *   A reverse index from the input messages to the datasets using them is built at start up.
+ *   A dataset is only processed again when one of its messages was received or changed freshness,
+ *   or when its confirmation is still running. Otherwise the result would be the same as the last cycle.
+ *
+***************************************************************/
+
+
+#include "ioen_IomLocal.h"
+
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incMessageKey
+ *
+ * DESCRIPTION:
+ *   This function returns the index of a message in the reverse indexes,
+ *   AFDX messages followed by A429 labels.
+ *
+ * INTERFACE:
+ *
+ *   In:  transport   : transport of the message
+ *   In:  msgIdx      : index of the message in the configuration
+ *
+ *   Return : index of the message, IOEN_INC_MAX_MESSAGES if the message can not be indexed
+ *
+ ******************************************************************/
+UInt32_t ioen_incMessageKey (
+    /* IN     */ const UInt32_t                    transport,
+    /* IN     */ const UInt32_t                    msgIdx
+)
+{
+    UInt32_t            key;
+
+    if (    (transport == IOEN_TRANSPORT_A664)
+        AND (msgIdx    <  IOEN_MAX_RX_PORT_NUMBER)
+       )
+    {
+        key = msgIdx;
+    }
+    else if (    (transport == IOEN_TRANSPORT_A429)
+             AND (msgIdx    <  IOEN_INC_MAX_A429_MESSAGES)
+            )
+    {
+        key = IOEN_MAX_RX_PORT_NUMBER + msgIdx;
+    }
+    else
+    {
+        /* Message can not be indexed */
+        key = IOEN_INC_MAX_MESSAGES;
+    }
+
+    return key;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incAddReference
+ *
+ * DESCRIPTION:
+ *   This function adds one message reference of a dataset to the reverse index.
+ *   In the count pass only the number of references per message is counted,
+ *   in the fill pass the dataset is stored (once per message).
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ *   In:  transport   : transport of the referenced message
+ *   In:  msgIdx      : index of the referenced message
+ *   In:  dsIdx       : index of the dataset
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
+ *
+ ******************************************************************/
+static void ioen_incAddReference (
+    /* IN     */ const UInt32_t                    transport,
+    /* IN     */ const UInt32_t                    msgIdx,
+    /* IN     */ const UInt32_t                    dsIdx,
+    /* IN     */ const Bool_t                      fillPass
+)
+{
+    UInt32_t            key;
+    UInt32_t            entry;
+    InputChangeIndex_t *index_p;
+
+    index_p = &ioen_inputChangeIndex;
+    key     = ioen_incMessageKey (transport, msgIdx);
+
+    if (key >= IOEN_INC_MAX_MESSAGES)
+    {
+        /* Message can not be indexed, process the dataset every cycle */
+        index_p->dsFlags[dsIdx] |= IOEN_INC_DS_ALWAYS;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    if (key < IOEN_INC_MAX_MESSAGES)
+    {
+        if (fillPass == FALSE)
+        {
+            /* Count pass, reserve space for this reference */
+            index_p->msgCount[key]++;
+        }
+        else
+        {
+            entry = index_p->msgFirst[key] + index_p->msgCount[key];
+
+            /* Datasets are added in increasing order, so a repeated reference is always the last entry */
+            if (    (index_p->msgCount[key] == 0)
+                OR  (index_p->dataset[entry - 1] != dsIdx)
+               )
+            {
+                index_p->dataset[entry] = (UInt16_t)dsIdx;
+                index_p->msgCount[key]++;
+            }
+            else
+            {
+                /* No action as designed                          */
+                /* Dataset already registered for this message    */
+            }
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incAddDataset
+ *
+ * DESCRIPTION:
+ *   This function adds all messages referenced by a dataset to the reverse index.
+ *   These are the messages of the validity conditions and of the input signals.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ *   In:  dataset_p   : pointer to dataset header
+ *   In:  dsIdx       : index of the dataset
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
+ *
+ ******************************************************************/
+static void ioen_incAddDataset (
+    /* IN     */ const InputDatasetHeader_t * const dataset_p,
+    /* IN     */ const UInt32_t                     dsIdx,
+    /* IN     */ const Bool_t                       fillPass
+)
+{
+    UInt32_t                    srcIdx;
+    UInt32_t                    condIdx;
+    UInt32_t                    parIdx;
+    const ValidityConfig_t     *validityLogic_p;
+    const ParamMappingConfig_t *parConfig_p;
+    const InputSignalConfig_t  *sigConfig_p;
+
+    /* first logic starts after dataset header */
+    validityLogic_p = (const ValidityConfig_t *)(dataset_p + 1);
+
+    /* Messages checked by the validity conditions of each source */
+    for (srcIdx = 0; srcIdx < dataset_p->numSources; srcIdx++)
+    {
+        for (condIdx = 0; condIdx < validityLogic_p[srcIdx].numConditions; condIdx++)
+        {
+            ioen_incAddReference (validityLogic_p[srcIdx].condition[condIdx].transport,
+                                  validityLogic_p[srcIdx].condition[condIdx].msgIdx,
+                                  dsIdx,
+                                  fillPass);
+        }
+    }
+
+    /* first parameter starts after logicSize bytes */
+    parConfig_p = (const ParamMappingConfig_t *)((const void *)validityLogic_p + dataset_p->logicSize);
+
+    /* Messages read by the input signals of each parameter */
+    for (parIdx = 0; parIdx < dataset_p->numParams; parIdx++)
+    {
+        sigConfig_p = (const InputSignalConfig_t *) ((const Byte_t *)parConfig_p + sizeof(ParamMappingConfig_t));
+
+        for (srcIdx = 0; srcIdx < parConfig_p->numSources; srcIdx++)
+        {
+            if (sigConfig_p[srcIdx].type == IOEN_INPUT_MAPPING_INT8_ADD)
+            {
+                /* Accumulating converter, the result changes every cycle */
+                ioen_inputChangeIndex.dsFlags[dsIdx] |= IOEN_INC_DS_ALWAYS;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            ioen_incAddReference (sigConfig_p[srcIdx].transport,
+                                  sigConfig_p[srcIdx].msgIdx,
+                                  dsIdx,
+                                  fillPass);
+        }
+
+        /* Next param */
+        parConfig_p = (const void *)parConfig_p + IOEN_SIZEOF_PARAM_MAPPING_CONFIG(parConfig_p);
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incAddAllDatasets
+ *
+ * DESCRIPTION:
+ *   This function adds all AFDX/A429 input datasets to the reverse index,
+ *   the single source datasets first, then the multiple source datasets.
+ *
+ * INTERFACE:
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
+ *
+ ******************************************************************/
+static void ioen_incAddAllDatasets (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p,
+    /* IN     */ const Bool_t                       fillPass
+)
+{
+    UInt32_t                    idx;
+    UInt32_t                    dsIdx;
+    const InputDatasetHeader_t *dataset_p;
+
+    dsIdx = 0;
+
+    dataset_p = (const InputDatasetHeader_t *) ((const void *)(iom_p) + iom_p->afdxInputDatasetStart);
+
+    for (idx = 0; idx < iom_p->afdxInputDatasetCount; idx++)
+    {
+        ioen_incAddDataset (dataset_p, dsIdx, fillPass);
+
+        dataset_p = (const void *)dataset_p + dataset_p->datasetSize;
+        dsIdx++;
+    }
+
+    dataset_p = (const InputDatasetHeader_t *) ((const void *)(iom_p) + iom_p->afdxInputDatasetMultiStart);
+
+    for (idx = 0; idx < iom_p->afdxInputDatasetMultiCount; idx++)
+    {
+        ioen_incAddDataset (dataset_p, dsIdx, fillPass);
+
+        dataset_p = (const void *)dataset_p + dataset_p->datasetSize;
+        dsIdx++;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incInitIndex
+ *
+ * DESCRIPTION:
+ *   This function builds the reverse index from input messages to input datasets.
+ *   If the configuration does not fit in the index, incremental processing stays off
+ *   and all datasets are processed every cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *
+ ******************************************************************/
+void ioen_incInitIndex (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t            key;
+    UInt32_t            nofEntries;
+    Bool_t              enabled;
+    InputChangeIndex_t *index_p;
+
+    index_p = &ioen_inputChangeIndex;
+
+    /* Keep the mode requested by the application */
+    enabled = index_p->enabled;
+
+    memset ((void *) index_p, 0x00, sizeof(InputChangeIndex_t));
+
+    index_p->enabled     = enabled;
+    index_p->nofDatasets = iom_p->afdxInputDatasetCount + iom_p->afdxInputDatasetMultiCount;
+
+    if (index_p->nofDatasets <= IOEN_INC_MAX_DATASETS)
+    {
+        /* Count the references per message */
+        ioen_incAddAllDatasets (iom_p, FALSE);
+
+        /* Reserve the entries of each message */
+        nofEntries = 0;
+        for (key = 0; key < IOEN_INC_MAX_MESSAGES; key++)
+        {
+            index_p->msgFirst[key] = nofEntries;
+            nofEntries            += index_p->msgCount[key];
+            index_p->msgCount[key] = 0;
+        }
+
+        if (nofEntries <= IOEN_INC_MAX_INDEX_ENTRIES)
+        {
+            /* Store the datasets per message */
+            ioen_incAddAllDatasets (iom_p, TRUE);
+
+            index_p->valid = TRUE;
+        }
+        else
+        {
+            /* No action as designed                        */
+            /* Too many references, index stays invalid     */
+        }
+    }
+    else
+    {
+        /* No action as designed                        */
+        /* Too many datasets, index stays invalid       */
+    }
+
+    /* Process all datasets in the first cycle */
+    ioen_incMarkAllDatasets ();
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setIncrementalInput
+ *
+ * DESCRIPTION:
+ *   This function switches incremental processing of the AFDX/A429 input datasets on or off.
+ *   When switched on, all datasets are processed once in the next cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ *   In:  enable      : TRUE = only process changed datasets, FALSE = process all datasets every cycle
+ *
+ ******************************************************************/
+void ioen_setIncrementalInput (
+    /* IN     */ const Bool_t                       enable
+)
+{
+    ioen_inputChangeIndex.enabled = enable;
+
+    ioen_incMarkAllDatasets ();
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incMarkAllDatasets
+ *
+ * DESCRIPTION:
+ *   This function marks all datasets to be processed in the next cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ ******************************************************************/
+void ioen_incMarkAllDatasets (
+    /*        */       void
+)
+{
+    UInt32_t dsIdx;
+
+    for (dsIdx = 0; dsIdx < IOEN_INC_MAX_DATASETS; dsIdx++)
+    {
+        ioen_inputChangeIndex.dsFlags[dsIdx] |= IOEN_INC_DS_DIRTY;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incMarkMessage
+ *
+ * DESCRIPTION:
+ *   This function marks all datasets and selection sets using a message to be processed in the next cycle.
+ *   It is called when the message was received or its freshness changed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *
+ *   In:  transport   : transport of the message (IOEN_TRANSPORT_A664 or IOEN_TRANSPORT_A429)
+ *   In:  msgIdx      : index of the message in the configuration
+ *
+ ******************************************************************/
+void ioen_incMarkMessage (
+    /* IN     */ const UInt32_t                    transport,
+    /* IN     */ const UInt32_t                    msgIdx
+)
+{
+    UInt32_t            key;
+    UInt32_t            entry;
+    UInt32_t            lastEntry;
+    InputChangeIndex_t *index_p;
+
+    index_p = &ioen_inputChangeIndex;
+    key     = ioen_incMessageKey (transport, msgIdx);
+
+    if (    (index_p->valid == TRUE)
+        AND (key < IOEN_INC_MAX_MESSAGES)
+       )
+    {
+        lastEntry = index_p->msgFirst[key] + index_p->msgCount[key];
+
+        for (entry = index_p->msgFirst[key]; entry < lastEntry; entry++)
+        {
+            index_p->dsFlags[index_p->dataset[entry]] |= IOEN_INC_DS_DIRTY;
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    /* The OBJECT_VALID selection sets checking this message */
+    ioen_ssMarkMessage (key);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incSkipDataset
+ *
+ * DESCRIPTION:
+ *   This function checks if the processing of a dataset can be skipped this cycle.
+ *   This is the case when none of its messages changed since it was last processed and
+ *   the confirmation of all its sources has finished, so processing would give the same result.
+ *   The health score of a skipped dataset is still updated, as ioen_ssGetSourceValidity would do.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *   Global Data      :  ioen_selectionSetlist
+ *
+ *   In    :  dsIdx       : index of the dataset
+ *   In    :  dataset_p   : pointer to dataset header
+ *   In    :  singleSource: TRUE for a dataset of the single source list
+ *   In    :  objectCtrl  : array of confirmation control objects
+ *
+ *   Return : TRUE if the dataset does not need to be processed
+ *
+ ******************************************************************/
+Bool_t ioen_incSkipDataset (
+    /* IN     */ const UInt32_t                         dsIdx,
+    /* IN     */ const InputDatasetHeader_t     * const dataset_p,
+    /* IN     */ const Bool_t                           singleSource,
+    /* IN     */ const IomObjectCtrlData_t              objectCtrl[IOEN_MAX_SOURCES_PER_INPUT]
+)
+{
+    Bool_t                  skip;
+    UInt32_t                srcIdx;
+    const ValidityConfig_t *validityLogic_p;
+    InputChangeIndex_t     *index_p;
+
+    index_p = &ioen_inputChangeIndex;
+
+    if (    (index_p->enabled == TRUE)
+        AND (index_p->valid   == TRUE)
+        AND ((index_p->dsFlags[dsIdx] BIT_AND (IOEN_INC_DS_DIRTY BIT_OR IOEN_INC_DS_ALWAYS)) == 0)
+       )
+    {
+        /* No message changed, check that confirmation has finished for all sources */
+        skip = TRUE;
+
+        for (srcIdx = 0; srcIdx < dataset_p->numSources; srcIdx++)
+        {
+            if (objectCtrl[srcIdx].cycle != 0)
+            {
+                skip = FALSE;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+        }
+    }
+    else
+    {
+        skip = FALSE;
+    }
+
+    if (skip == TRUE)
+    {
+        if (    (singleSource        == FALSE)
+            OR  (dataset_p->numSources == 1)
+           )
+        {
+            /* Same health score as ioen_ssGetSourceValidity, validities did not change */
+            validityLogic_p = (const ValidityConfig_t *)(dataset_p + 1);
+
+            for (srcIdx = 0; srcIdx < dataset_p->numSources; srcIdx++)
+            {
+                if (objectCtrl[srcIdx].validity.current.value == IOEN_GLOB_DATA_VALID)
+                {
+                    ioen_selectionSetlist[validityLogic_p->sourceSet].healthScore[srcIdx]++;
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+            }
+        }
+        else
+        {
+            /* No action as designed                               */
+            /* Source validity is not evaluated for this dataset   */
+        }
+    }
+    else if (    (index_p->enabled == TRUE)
+             AND (index_p->valid   == TRUE)
+            )
+    {
+        /* Dataset is processed this cycle */
+        index_p->dsFlags[dsIdx] = (index_p->dsFlags[dsIdx] BIT_AND (Byte_t)(BIT_NOT IOEN_INC_DS_DIRTY)) BIT_OR IOEN_INC_DS_PROCESSED;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    return skip;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_incSkipDatasetValue
+ *
+ * DESCRIPTION:
+ *   This function checks if routing the selected source of a multiple source dataset can be skipped this cycle.
+ *   This is the case when the dataset was not processed and the same source is still selected.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inputChangeIndex
+ *   Global Data      :  ioen_selectionSetlist
+ *
+ *   In    :  dsIdx       : index of the dataset
+ *   In    :  dataset_p   : pointer to dataset header
+ *
+ *   Return : TRUE if the value does not need to be routed
+ *
+ ******************************************************************/
+Bool_t ioen_incSkipDatasetValue (
+    /* IN     */ const UInt32_t                         dsIdx,
+    /* IN     */ const InputDatasetHeader_t     * const dataset_p
+)
+{
+    Bool_t                  skip;
+    UInt32_t                selectedSource;
+    const ValidityConfig_t *validityLogic_p;
+    InputChangeIndex_t     *index_p;
+
+    index_p = &ioen_inputChangeIndex;
+
+    if (    (index_p->enabled == TRUE)
+        AND (index_p->valid   == TRUE)
+       )
+    {
+        validityLogic_p = (const ValidityConfig_t *)(dataset_p + 1);
+        selectedSource  = ioen_selectionSetlist[validityLogic_p->sourceSet].selectedSource;
+
+        if (    ((index_p->dsFlags[dsIdx] BIT_AND IOEN_INC_DS_PROCESSED) == 0)
+            AND (index_p->dsSelected[dsIdx] == selectedSource)
+           )
+        {
+            skip = TRUE;
+        }
+        else
+        {
+            skip = FALSE;
+
+            index_p->dsFlags[dsIdx]   &= (Byte_t)(BIT_NOT IOEN_INC_DS_PROCESSED);
+            index_p->dsSelected[dsIdx] = selectedSource;
+        }
+    }
+    else
+    {
+        skip = FALSE;
+    }
+
+    return skip;
+}
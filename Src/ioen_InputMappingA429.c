@@ -71,6 +71,149 @@ UInt32_t ioen_im4GetA429Sdi(
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_im4FindLabel
+ *
+ * DESCRIPTION:
+ *   This function returns the control data of a configured label of a port.
+ *   The bit of the label in the presence bitmap of the port gives its rank among the configured labels
+ *   of the port, the lookup time does not depend on the number of labels.
+ *
+ * INTERFACE:
+ *   Global Data      : ioen_a429MsgControl
+ *   Global Data      : ioen_a429LabelCtrl
+ *
+ *   In:  portIdx        : Port of the label
+ *   In:  labelId        : Label code
+ *   In:  sdi            : SDI of the label
+ *
+ *   Return:  Control data of the label, NULL if the label is not configured
+ *
+ ******************************************************************/
+A429MessageCtrlData_t * ioen_im4FindLabel (
+   /* IN     */ const UInt32_t                   portIdx,
+   /* IN     */ const UInt32_t                   labelId,
+   /* IN     */ const UInt32_t                   sdi
+)
+{
+    UInt32_t               bit;
+    UInt32_t               word;
+    UInt32_t               mask;
+    A429MessageCtrl_t     *portCtrl_p;
+    A429MessageCtrlData_t *labelCtrl_p;
+
+    labelCtrl_p = NULL_PTR;
+
+    if ((portIdx < IOEN_A429_MAX_PORTS) AND (labelId < IOEN_A429_MAX_LABELS) AND (sdi < IOEN_A429_MAX_SDI))
+    {
+        portCtrl_p = &ioen_a429MsgControl[portIdx];
+        bit        = (labelId * IOEN_A429_MAX_SDI) + sdi;
+        word       = bit BIT_RSHIFT 5;
+        mask       = 1U BIT_LSHIFT (bit BIT_AND 31);
+
+        if ((portCtrl_p->present[word] BIT_AND mask) != 0)
+        {
+            labelCtrl_p = &ioen_a429LabelCtrl[portCtrl_p->first
+                                              + portCtrl_p->rankBase[word]
+                                              + ioen_UtilPopCount (portCtrl_p->present[word] BIT_AND (mask - 1))];
+        }
+        else
+        {
+            /* No action as designed, label not configured */
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    return labelCtrl_p;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_im4RecordArrival
+ *
+ * DESCRIPTION:
+ *   This function records the arrival of a label, and updates its period and jitter.
+ *   A label received again in the same port read only counts as update.
+ *
+ * INTERFACE:
+ *   Global Data      : ioen_a429Rate
+ *
+ *   In:  entryIdx       : Index of the label in ioen_a429LabelCtrl
+ *
+ ******************************************************************/
+static void ioen_im4RecordArrival (
+    /* IN     */ const UInt32_t                    entryIdx
+)
+{
+    SYSTEM_TIME_TYPE        period;
+    SYSTEM_TIME_TYPE        deviation;
+    A429LabelStatistics_t  *stats_p;
+
+    stats_p = &ioen_a429Rate.label[entryIdx];
+
+    if (stats_p->updates == 0)
+    {
+        /* First arrival, no period yet */
+    }
+    else if (ioen_a429Rate.now <= stats_p->lastArrival)
+    {
+        stats_p->sameRead++;
+    }
+    else
+    {
+        period = ioen_a429Rate.now - stats_p->lastArrival;
+
+        if (stats_p->meanPeriod == 0)
+        {
+            /* First period */
+            stats_p->minPeriod  = period;
+            stats_p->maxPeriod  = period;
+            stats_p->meanPeriod = period;
+        }
+        else
+        {
+            if (period < stats_p->minPeriod)
+            {
+                stats_p->minPeriod = period;
+            }
+            else if (period > stats_p->maxPeriod)
+            {
+                stats_p->maxPeriod = period;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            deviation = period - stats_p->meanPeriod;
+
+            if (deviation < 0)
+            {
+                deviation = -deviation;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+
+            /* Smoothed values, the new value weighs 1 / (2 ^ IOEN_A429_RATE_SHIFT) */
+            stats_p->jitter     += (deviation - stats_p->jitter)     / (1 BIT_LSHIFT IOEN_A429_RATE_SHIFT);
+            stats_p->meanPeriod += (period    - stats_p->meanPeriod) / (1 BIT_LSHIFT IOEN_A429_RATE_SHIFT);
+        }
+    }
+
+    stats_p->lastArrival = ioen_a429Rate.now;
+    stats_p->updates++;
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_im4ProcessA429Message
@@ -82,6 +225,9 @@ UInt32_t ioen_im4GetA429Sdi(
  *   Global Data      : ioen_iomConfig_p
  *   Global Data      : ioen_inMsgBuffer
  *   Global Data      : ioen_a429MsgControl
+ *   Global Data      : ioen_a429LabelCtrl
+ *   Global Data      : ioen_a429Freshness
+ *   Global Data      : ioen_a429Rate
  *
  *   In:  portId         : Port source of message Label data
  *   In:  a429Label      : Raw data of A429 message (NB: only one label)
@@ -112,15 +258,24 @@ void ioen_im4ProcessA429Message(
     sdi         = ioen_im4GetA429Sdi   (a429word);
 
     /* Get control data for this label */
-    msgCtrl_p = &ioen_a429MsgControl[portIdx].data[labelId][sdi];
+    msgCtrl_p = ioen_im4FindLabel (portIdx, labelId, sdi);
 
-    if (msgCtrl_p->msgInfo_p != 0)
+    if (msgCtrl_p != NULL_PTR)
     {
         /* Label config valid for this messsage */
 
         /* Indicate new data and save raw data in correct place in the input message buffer */
-        ioen_ConfirmSetNewMsgData (&msgCtrl_p->ctrl);
+        ioen_frNewData (&ioen_a429Freshness, msgCtrl_p->labelIdx);
         dataStart_p[labelId].data[sdi].raw = a429Label;
+
+        if (ioen_a429Rate.enabled == TRUE)
+        {
+            ioen_im4RecordArrival ((UInt32_t)(msgCtrl_p - &ioen_a429LabelCtrl[0]));
+        }
+        else
+        {
+            /* No action as designed */
+        }
     }
     else
     {
@@ -20,13 +20,79 @@
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imaDoInputMappings
+ *   ioen_imaCopyParamToParamBuffer
  *
  * DESCRIPTION:
- *   This function reads multiple bytes from Input Message Buffer and copies it into the Parameter Buffer
+ *   This function copies one parameter of the selected source from the source buffer into the Parameter Buffer
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inParamBuffer
+ *   Global Data      :  ioen_inParamBufferSrc
+ *
+ *   In:  curParam_p      : Parameter Config
+ *   In:  sigConfig_p     : Input Signal Config of the selected source
+ *   In:  selectedSource  : Selected source in the selection set
+ *   In:  valid_p         : control object for validities
+ *
+ ******************************************************************/
+void ioen_imaCopyParamToParamBuffer (
+    /* IN     */ const ParamMappingConfig_t * const curParam_p,
+    /* IN     */ const InputSignalConfig_t  * const sigConfig_p,
+    /* IN     */ const UInt32_t                     selectedSource,
+    /* IN     */ const Valid_t              * const valid_p
+)
+{
+    Validity_t                  validityNew;
+
+    if (valid_p->confirmed.value == IOEN_GLOB_DATA_INIT_VALUE)
+    {
+        /* Initial value is not confirmed in buffer, use initial value */
+        validityNew = valid_p->confirmed;
+
+        /* Set output data to zero */
+        memset ((UInt32_t *)(ioen_inParamBuffer + curParam_p->parOffset), 0, curParam_p->parSize/8);
+
+        /* Set current source */
+        validityNew.selectedSource = selectedSource + 1;
+
+        /* Copy status to  application buffer */
+        *(UInt32_t *)(ioen_inParamBuffer + curParam_p->valOffset) = * ((UInt32_t *) &validityNew);
+    }
+    else if (valid_p->confirmed.value == valid_p->current.value)
+    {
+        /* Copy from param source buffer to param buffer */
+        /* Only copy a confirmed value, initial value, otherwise previous value is used */
+
+        /* Read confirmed status from buffer */
+        validityNew = * (Validity_t *)(ioen_inParamBufferSrc + sigConfig_p->valOffset);
+
+        /* Copy confirmed data */
+        memcpy ((UInt32_t *)(ioen_inParamBuffer + curParam_p->parOffset),
+                (UInt32_t *)(ioen_inParamBufferSrc + sigConfig_p->parOffset),
+                curParam_p->parSize/8);
+
+        /* Set current source */
+        validityNew.selectedSource = selectedSource + 1;
+
+        /* Copy status to  application buffer */
+        *(UInt32_t *)(ioen_inParamBuffer + curParam_p->valOffset) = * ((UInt32_t *) &validityNew);
+    }
+    else
+    {
+        /* No action, as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imaCopyToParamBuffer
+ *
+ * DESCRIPTION:
+ *   This function copies all parameters of the selected source from the source buffer into the Parameter Buffer
  *
  * INTERFACE:
- *   Global Data      :  ioen_inputConverters
  *   Global Data      :  ioen_inParamBuffer
  *
  *   In:  parConfig_p     : Parameter Config
@@ -42,7 +108,6 @@ void ioen_imaCopyToParamBuffer (
     /* IN OUT */       Valid_t              * const valid_p
 )
 {
-    Validity_t                  validityNew;
     UInt16_t                    curMap;      /* Index of current Mapping being processed. */
     const ParamMappingConfig_t *curParam_p;  /* pointer to current parameter mapping      */
     InputSignalConfig_t        *sigConfig_p; /* Address of the Input Signal Configuration */
@@ -62,43 +127,7 @@ void ioen_imaCopyToParamBuffer (
         /* Obtain the address of the selected signal configuration */
         sigConfig_p = &sigConfig_p[selectedSource];
 
-        if (valid_p->confirmed.value == IOEN_GLOB_DATA_INIT_VALUE)
-        {
-            /* Initial value is not confirmed in buffer, use initial value */
-            validityNew = valid_p->confirmed;
-
-            /* Set output data to zero */
-            memset ((UInt32_t *)(ioen_inParamBuffer + curParam_p->parOffset), 0, curParam_p->parSize/8);
-
-            /* Set current source */
-            validityNew.selectedSource = selectedSource + 1;
-
-            /* Copy status to  application buffer */
-            *(UInt32_t *)(ioen_inParamBuffer + curParam_p->valOffset) = * ((UInt32_t *) &validityNew);
-        }
-        else if (valid_p->confirmed.value == valid_p->current.value)
-        {
-            /* Copy from param source buffer to param buffer */
-            /* Only copy a confirmed value, initial value, otherwise previous value is used */
-
-            /* Read confirmed status from buffer */
-            validityNew = * (Validity_t *)(ioen_inParamBufferSrc + sigConfig_p->valOffset);
-
-            /* Copy confirmed data */
-            memcpy ((UInt32_t *)(ioen_inParamBuffer + curParam_p->parOffset),
-                    (UInt32_t *)(ioen_inParamBufferSrc + sigConfig_p->parOffset),
-                    curParam_p->parSize/8);
-
-            /* Set current source */
-            validityNew.selectedSource = selectedSource + 1;
-
-            /* Copy status to  application buffer */
-            *(UInt32_t *)(ioen_inParamBuffer + curParam_p->valOffset) = * ((UInt32_t *) &validityNew);
-        }
-        else
-        {
-            /* No action, as designed */
-        }
+        ioen_imaCopyParamToParamBuffer (curParam_p, sigConfig_p, selectedSource, valid_p);
 
         /* Next param */
         curParam_p = (void *)curParam_p + IOEN_SIZEOF_PARAM_MAPPING_CONFIG(curParam_p);
@@ -73,14 +73,222 @@ void ioen_imcDoOneInputMapping (
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcAddMappings
+ *
+ * DESCRIPTION:
+ *   This function compiles the mappings of one CAN input message configuration into ioen_canMapPlan.
+ *   A message with more than IOEN_MAX_CAN_PARAM_PER_MESSAGE mappings, an unknown converter or check type,
+ *   or more mappings than the plan can hold is not compiled, its configuration is walked instead.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canMapPlan
+ *   Global Data      :  ioen_inParamBuffer
+ *   Global Data      :  ioen_inParamBufferSrc
+ *
+ *   In:  msgConfig_p : Configuration of the message
+ *
+ *   Return : First descriptor of the message, or IOEN_CAN_MAP_NONE
+ *
+ ******************************************************************/
+static UInt32_t ioen_imcAddMappings (
+    /* IN     */ const CanMessageConfig_t     * const msgConfig_p
+)
+{
+    UInt32_t                      first;
+    UInt32_t                      cnt;
+    UInt32_t                      valIdx;
+    Bool_t                        fits;
+    const simpleMapConfigCanIn_t *curMap_p;
+    CanMapDesc_t                 *desc_p;
+
+    curMap_p = (const simpleMapConfigCanIn_t*)(msgConfig_p + 1);
+    fits     = (msgConfig_p->numMappings <= IOEN_MAX_CAN_PARAM_PER_MESSAGE)
+               AND ((ioen_nofCanMapDesc + msgConfig_p->numMappings) <= IOEN_CAN_MAX_MAPPINGS);
+
+    for (cnt = 0; (cnt < msgConfig_p->numMappings) AND (fits == TRUE); cnt++)
+    {
+        fits = (curMap_p[cnt].sigconfig.type < IOEN_NUMBER_INPUT_MAPPING_TYPES) AND (curMap_p[cnt].validity.numConditions <= IOEN_MAX_CAN_VALIDITY_CONDITIONS);
+
+        for (valIdx = 0; (valIdx < curMap_p[cnt].validity.numConditions) AND (fits == TRUE); valIdx++)
+        {
+            fits = (curMap_p[cnt].validity.conditionType[valIdx] < IOEN_NUMBER_CONDITION_TYPES);
+        }
+    }
+
+    if (fits == TRUE)
+    {
+        first = ioen_nofCanMapDesc;
+
+        for (cnt = 0; cnt < msgConfig_p->numMappings; cnt++)
+        {
+            desc_p = &ioen_canMapPlan[ioen_nofCanMapDesc];
+
+            desc_p->map_p     = curMap_p;
+            desc_p->convert   = ioen_inputConverters[curMap_p->sigconfig.type];
+            desc_p->srcVal_p  = (UInt32_t *)(ioen_inParamBufferSrc + curMap_p->sigconfig.valOffset);
+            desc_p->dstVal_p  = (UInt32_t *)(ioen_inParamBuffer    + curMap_p->parconfig.valOffset);
+            desc_p->srcPar_p  = ioen_inParamBufferSrc + curMap_p->sigconfig.parOffset;
+            desc_p->dstPar_p  = ioen_inParamBuffer    + curMap_p->parconfig.parOffset;
+            desc_p->parBytes  = (UInt16_t)(curMap_p->parconfig.parSize / 8);
+            desc_p->internal  = (curMap_p->parconfig.numSources == 0);
+            desc_p->nofChecks = (Byte_t)curMap_p->validity.numConditions;
+
+            for (valIdx = 0; valIdx < desc_p->nofChecks; valIdx++)
+            {
+                desc_p->check[valIdx] = ioen_validityChecker[curMap_p->validity.conditionType[valIdx]];
+            }
+
+            ioen_nofCanMapDesc++;
+            curMap_p++;
+        }
+    }
+    else
+    {
+        first = IOEN_CAN_MAP_NONE;
+    }
+
+    return (first);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcCompileMappings
+ *
+ * DESCRIPTION:
+ *   This function compiles the mappings of all CAN input messages, per configured source (RCI),
+ *   after ioen_initCanControl. A source that is also the first configured source shares its descriptors
+ *   with the invalidation.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_mrcCanMessageControl
+ *   Global Data      :  ioen_nofCanMessages
+ *   Global Data      :  ioen_nofCanMapDesc
+ *
+ ******************************************************************/
+void ioen_imcCompileMappings (
+    /* IN     */ void
+)
+{
+    UInt32_t                  idx;
+    UInt32_t                  rci;
+    CANMessageControl_t      *msgCtrl_p;
+
+    ioen_nofCanMapDesc = 0;
+
+    for (idx = 0; idx < ioen_nofCanMessages; idx++)
+    {
+        msgCtrl_p = &ioen_mrcCanMessageControl[idx];
+        msgCtrl_p->mapInvalidate = (UInt16_t)ioen_imcAddMappings (msgCtrl_p->msgConfigFirst_p);
+
+        for (rci = 0; rci < IOEN_CAN_MAX_RCI; rci++)
+        {
+            if (msgCtrl_p->msgConfigSource_p[rci] == msgCtrl_p->msgConfigFirst_p)
+            {
+                msgCtrl_p->mapFirst[rci] = msgCtrl_p->mapInvalidate;
+            }
+            else if (msgCtrl_p->msgConfigSource_p[rci] != NULL_PTR)
+            {
+                msgCtrl_p->mapFirst[rci] = (UInt16_t)ioen_imcAddMappings (msgCtrl_p->msgConfigSource_p[rci]);
+            }
+            else
+            {
+                /* Source not configured */
+                msgCtrl_p->mapFirst[rci] = IOEN_CAN_MAP_NONE;
+            }
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcRunMappings
+ *
+ * DESCRIPTION:
+ *   This function performs the compiled mappings of one message, and copies the
+ *   validity and the value of each parameter to the parameter buffer.
+ *   It gives the same results as ioen_imcDoOneInputMapping and the copy per mapping.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canMapPlan
+ *   Global Data      :  ioen_inParamBufferSrc
+ *
+ *   In    :  validity   : Validity of input message
+ *   In    :  first      : First descriptor of the message
+ *   In    :  numMaps    : Number of mappings of the message
+ *   In    :  msg_p      : pointer to input message buffer
+ *
+ ******************************************************************/
+static void ioen_imcRunMappings (
+    /* IN     */ const Validity_t                     validity,
+    /* IN     */ const UInt32_t                       first,
+    /* IN     */ const UInt32_t                       numMaps,
+    /* IN     */ const CANMessage_t           * const msg_p
+)
+{
+    UInt32_t            cnt;
+    UInt32_t            valIdx;
+    Validity_t          newValidity;
+    const CanMapDesc_t *desc_p;
+
+    desc_p = &ioen_canMapPlan[first];
+
+    for (cnt = 0; cnt < numMaps; cnt++)
+    {
+        if (desc_p->internal == TRUE)
+        {
+            /* Internal parameter, just set status to valid */
+            newValidity.spare          = 0;
+            newValidity.selectedSource = 0;
+            newValidity.value          = IOEN_GLOB_DATA_VALID;
+            newValidity.ifValue        = IOEN_VALIDITY_NORMALOP;
+            *desc_p->srcVal_p          = * ((UInt32_t *) &newValidity);
+        }
+        else
+        {
+            newValidity = validity;
+            for (valIdx = 0; (valIdx < desc_p->nofChecks) AND (newValidity.value == IOEN_GLOB_DATA_VALID); valIdx++)
+            {
+                newValidity = desc_p->check[valIdx](&msg_p->data[0], &desc_p->map_p->validity.condition[valIdx]);
+            }
+
+            desc_p->convert (newValidity, &desc_p->map_p->parconfig, &desc_p->map_p->sigconfig, &msg_p->data[0], ioen_inParamBufferSrc);
+        }
+
+        /* Copy confirmed status and data */
+        *desc_p->dstVal_p = *desc_p->srcVal_p;
+
+        if (desc_p->parBytes == 4)
+        {
+            /* 32 bits can be copied as a word in one operation for optimisation */
+            *(UInt32_t *)desc_p->dstPar_p = *(const UInt32_t *)desc_p->srcPar_p;
+        }
+        else
+        {
+            memcpy (desc_p->dstPar_p, desc_p->srcPar_p, desc_p->parBytes);
+        }
+
+        desc_p++;
+    }
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_imcProcessCanMessage
  *
  * DESCRIPTION:
  *   This function extracts signals from the message buffer and copy to param buffer according to mappings associated with message
+ *   The compiled mappings of the source are used, if the message was compiled by ioen_imcCompileMappings
  *
  * INTERFACE:
+ *   Global Data      :  ioen_canMapPlan
  *
  *   In Out:  msgctrl_p      : Runtime control data for input message 
  *   In    :  mapConfig_p    : A Config with one Parameter and on signal Config
@@ -99,6 +307,7 @@ void ioen_imcProcessCanMessage (
      */
     UInt32_t                      tmp;
     UInt32_t                      fs;
+    UInt32_t                      rci;
     Byte_t                        cnt;           /* Index of current Mapping being processed. */
     Byte_t                        numMaps;       /* number of mappings for the message        */
     const simpleMapConfigCanIn_t *curMap_p;      /* pointer to current parameter mapping      */
@@ -127,8 +336,22 @@ void ioen_imcProcessCanMessage (
         msgctrl_p->msgValidCtrl.validity.current.ifValue = IOEN_VALIDITY_NODATA;
     }
 
+    rci = msg_p->canId BIT_AND A825_CAN_ID_RCI_MASK;
+
     /* Copy to output buffer if value is valid */
-    if (msgctrl_p->msgValidCtrl.validity.current.value == IOEN_GLOB_DATA_VALID)
+    if (msgctrl_p->msgValidCtrl.validity.current.value != IOEN_GLOB_DATA_VALID)
+    {
+        /* No action as designed */
+        /* Invalid values are not copied to parameter buffer until they are confirmed */
+    }
+    else if (   (msgctrl_p->mapFirst[rci] != IOEN_CAN_MAP_NONE)
+             AND (msgctrl_p->msgConfigSource_p[rci] == msgConfig_p)
+            )
+    {
+        /* Process all parameters to internal buffer, with the compiled mappings */
+        ioen_imcRunMappings (msgctrl_p->msgValidCtrl.validity.current, msgctrl_p->mapFirst[rci], msgConfig_p->numMappings, msg_p);
+    }
+    else
     {
         /* Process all parameters to internal buffer */
         curMap_p = (const simpleMapConfigCanIn_t*)(msgConfig_p + 1);
@@ -162,11 +385,6 @@ void ioen_imcProcessCanMessage (
             curMap_p++;
         }
     }
-    else
-    {
-        /* No action as designed */
-        /* Invalid values are not copied to parameter buffer until they are confirmed */
-    }
 
 }
 
@@ -214,8 +432,20 @@ void ioen_imcInvalidateCanMessage (
     }
 
     /* Process all parameters from first source (any source could be used) to internal buffer */
-    numMaps  = msgctrl_p->msgConfigSource1_p->numMappings;
-    curMap_p = (const simpleMapConfigCanIn_t*)(msgctrl_p->msgConfigSource1_p + 1);
+    numMaps  = msgctrl_p->msgConfigFirst_p->numMappings;
+    curMap_p = (const simpleMapConfigCanIn_t*)(msgctrl_p->msgConfigFirst_p + 1);
+
+    if (msgctrl_p->mapInvalidate != IOEN_CAN_MAP_NONE)
+    {
+        /* Compiled mappings, the result is the same as the configuration walk */
+        ioen_imcRunMappings (msgctrl_p->msgValidCtrl.validity.confirmed, msgctrl_p->mapInvalidate, numMaps, &canMsg);
+        numMaps = 0;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
     for (cnt = 0; cnt < numMaps; cnt++)
     {
         /* Process these mappings to invalidate its parameters */
@@ -246,325 +476,581 @@ void ioen_imcInvalidateCanMessage (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imcStartInputCan
+ *   ioen_imcMergeRanges
  *
  * DESCRIPTION:
- *   This function resets all addition parameters to 0
+ *   This function sorts the ranges of a buffer by offset, and merges overlapping and adjacent ranges.
+ *   Accumulators of one message are usually adjacent, so few ranges remain.
  *
  * INTERFACE:
- *   Global Data      :  ioen_inParamBufferSrc
- *   Global Data      :  ioen_iomConfig_p
+ *
+ *   In Out:  range_p : Ranges of one buffer
+ *   In Out:  nof_p   : Number of ranges
  *
  ******************************************************************/
-void ioen_imcStartInputCan (
-    /*        */ void
+static void ioen_imcMergeRanges (
+    /* IN OUT */       CanResetRange_t    * const range_p,
+    /* IN OUT */       UInt32_t           * const nof_p
 )
 {
-    UInt32_t            msgcnt;
-    CanMessageConfig_t *msg_p;
-    UInt32_t            msgidx;
-    UInt32_t            mapidx;
-    simpleMapConfig_t  *singleMap_p;
-    UInt32_t                  portIdx;
-    IOMCanRoutingPortTbl_t   *iomCanPort;
+    UInt32_t            idx;
+    UInt32_t            pos;
+    UInt32_t            nofOut;
+    UInt32_t            end;
+    CanResetRange_t     tmp;
+
+    /* Insertion sort, only done at start up */
+    for (idx = 1; idx < *nof_p; idx++)
+    {
+        tmp = range_p[idx];
+        pos = idx;
 
+        while ((pos > 0) AND (range_p[pos - 1].offset > tmp.offset))
+        {
+            range_p[pos] = range_p[pos - 1];
+            pos--;
+        }
+        range_p[pos] = tmp;
+    }
 
-    msgcnt = ioen_iomConfig_p->canInputMessageCount;
-    msg_p  = CAN_INPUT_MSGINFO_FIRST(ioen_iomConfig_p);
+    nofOut = 0;
 
-    /* reset all counter to 0, we will add the other values */
-    for (msgidx = 0; msgidx < msgcnt; msgidx++)
+    for (idx = 0; idx < *nof_p; idx++)
     {
-        singleMap_p = (simpleMapConfig_t *)(msg_p + 1);    /* mappings start directly after message */
-
-        for (mapidx = 0; mapidx < msg_p->numMappings; mapidx++)
+        if ((nofOut > 0) AND (range_p[idx].offset <= (range_p[nofOut - 1].offset + range_p[nofOut - 1].size)))
         {
-            if (singleMap_p->sigconfig.type == IOEN_INPUT_MAPPING_INT8_ADD)
-            {
-                *((UInt32_t*)(ioen_inParamBufferSrc + singleMap_p->sigconfig.parOffset)) = 0;
-				  *((UInt32_t*)(ioen_inParamBuffer    + singleMap_p->parconfig.parOffset)) = 0;
+            /* Overlapping or adjacent, extend the previous range */
+            end = range_p[idx].offset + range_p[idx].size;
 
-                singleMap_p++;
+            if (end > (range_p[nofOut - 1].offset + range_p[nofOut - 1].size))
+            {
+                range_p[nofOut - 1].size = end - range_p[nofOut - 1].offset;
             }
             else
             {
-                /* No action as designed */
+                /* No action as designed, contained in the previous range */
             }
         }
-
-        msg_p = CAN_INPUT_MSGINFO_NEXT(msg_p);
+        else
+        {
+            range_p[nofOut] = range_p[idx];
+            nofOut++;
+        }
     }
 
-    /* Clear previous CAN Routing messages */
-    portIdx    = 0;
-    iomCanPort = &ioen_mrcConfigRoutingTable_p[0];
-    while (iomCanPort->canType != IOEN_CAN_PORT_TYPE_TERMINATOR)
-    {
-        iomCanPort->nofOutMsg = 0;
-
-        portIdx++;
-        iomCanPort = &ioen_mrcConfigRoutingTable_p[portIdx];
-    }
+    *nof_p = nofOut;
 }
 
 
 
-
-
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imcLookupMessage
+ *   ioen_imcInitResetRanges
  *
  * DESCRIPTION:
- *   This function looks up can ID in list of message configuration records
- *   Perform a linear search, since we have just (7-10) messages configured
+ *   This function collects the accumulators of all IOEN_INPUT_MAPPING_INT8_ADD mappings of the CAN input messages,
+ *   in the source buffer and in the parameter buffer, and merges them into ranges of adjacent words.
+ *   If there are more than IOEN_CAN_MAX_RESET_WORDS accumulators, the configuration is walked each cycle.
  *
  * INTERFACE:
  *   Global Data      :  ioen_iomConfig_p
- *
- *   In:  canId       : CAN ID to read
- *   Out: msgConfig_p : Pointer to configuration of this CAN ID, no match, return NULL
- *   Out: msgCtrl_p   : Pointer to runtime data of this CAN ID, no match, return NULL
- *
+ *   Global Data      :  ioen_canReset
  *
  ******************************************************************/
-void ioen_imcLookupMessage (
-   /* IN     */ const UInt32_t                       canId,
-   /*    OUT */ const CanMessageConfig_t          ** msgConfig_p,
-   /*    OUT */       CANMessageControl_t         ** msgCtrl_p
+void ioen_imcInitResetRanges (
+    /*        */ void
 )
 {
-    UInt32_t                  idxCanId;
-    UInt32_t                  canIdIgnoreFsRci;
-
-    *msgConfig_p = (const CanMessageConfig_t *) 0;
-    *msgCtrl_p   = (CANMessageControl_t *) 0;
-
-    /* mask out  RCI, FS and unused top 3 bits */
-    canIdIgnoreFsRci = canId BIT_AND A825_CAN_ID_IGNORE_FS_RCI_MASK;
-
-    /* Get CAN Control runtime data */
-    for (idxCanId = 0; idxCanId < ioen_nofCanMessages; idxCanId++)
+    UInt32_t                      msgidx;
+    UInt32_t                      mapidx;
+    const CanMessageConfig_t     *msg_p;
+    const simpleMapConfigCanIn_t *curMap_p;
+    CanResetRanges_t             *reset_p;
+
+    reset_p         = &ioen_canReset;
+    reset_p->walk   = FALSE;
+    reset_p->nofSrc = 0;
+    reset_p->nofPar = 0;
+    msg_p           = CAN_INPUT_MSGINFO_FIRST(ioen_iomConfig_p);
+
+    for (msgidx = 0; msgidx < ioen_iomConfig_p->canInputMessageCount; msgidx++)
     {
-        if (ioen_mrcCanMessageControl[idxCanId].canIdMasked == canIdIgnoreFsRci)
+        curMap_p = (const simpleMapConfigCanIn_t *)(msg_p + 1);    /* mappings start directly after message */
+
+        for (mapidx = 0; mapidx < msg_p->numMappings; mapidx++)
         {
-            *msgCtrl_p = &ioen_mrcCanMessageControl[idxCanId];
-            if ((canId BIT_AND A825_CAN_ID_RCI_MASK) == 0)
+            if (curMap_p->sigconfig.type != IOEN_INPUT_MAPPING_INT8_ADD)
+            {
+                /* No action as designed */
+            }
+            else if (reset_p->nofSrc < IOEN_CAN_MAX_RESET_WORDS)
             {
-                /* Source 1 */
-                *msgConfig_p = ioen_mrcCanMessageControl[idxCanId].msgConfigSource1_p;
+                reset_p->src[reset_p->nofSrc].offset = curMap_p->sigconfig.parOffset;
+                reset_p->src[reset_p->nofSrc].size   = sizeof(UInt32_t);
+                reset_p->par[reset_p->nofPar].offset = curMap_p->parconfig.parOffset;
+                reset_p->par[reset_p->nofPar].size   = sizeof(UInt32_t);
+                reset_p->nofSrc++;
+                reset_p->nofPar++;
             }
             else
             {
-                /* Source 2 */
-                *msgConfig_p = ioen_mrcCanMessageControl[idxCanId].msgConfigSource2_p;
+                reset_p->walk = TRUE;
             }
-            break;
-        }
-        else
-        {
-            /* No action as designed */
+
+            curMap_p++;
         }
+
+        msg_p = CAN_INPUT_MSGINFO_NEXT(msg_p);
     }
 
+    ioen_imcMergeRanges (&reset_p->src[0], &reset_p->nofSrc);
+    ioen_imcMergeRanges (&reset_p->par[0], &reset_p->nofPar);
 }
 
 
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imcCheckMessageFreshness
+ *   ioen_imcStartInputCan
  *
  * DESCRIPTION:
- *   This function checks the freshness of a CAN message
+ *   This function resets all addition parameters to 0
+ *   The ranges built by ioen_imcInitResetRanges are cleared, the configuration is only walked
+ *   if the accumulators did not fit in the ranges.
  *
  * INTERFACE:
+ *   Global Data      :  ioen_inParamBufferSrc
+ *   Global Data      :  ioen_inParamBuffer
  *   Global Data      :  ioen_iomConfig_p
- *   Global Data      :  ioen_mrcCanMessageControl
- *
+ *   Global Data      :  ioen_canReset
  *
  ******************************************************************/
-void ioen_imcCheckMessageFreshness (
-   /* IN     */ void
+void ioen_imcStartInputCan (
+    /*        */ void
 )
 {
-    UInt32_t                  idx;
-    CANMessageControl_t      *msgctrl_p;
-
+    UInt32_t                      msgcnt;
+    const CanMessageConfig_t     *msg_p;
+    UInt32_t                      msgidx;
+    UInt32_t                      mapidx;
+    UInt32_t                      idx;
+    const simpleMapConfigCanIn_t *singleMap_p;
+
+    if (ioen_canReset.walk == FALSE)
+    {
+        /* reset all counter to 0, we will add the other values */
+        for (idx = 0; idx < ioen_canReset.nofSrc; idx++)
+        {
+            memset (ioen_inParamBufferSrc + ioen_canReset.src[idx].offset, 0, ioen_canReset.src[idx].size);
+        }
 
-    for (idx = 0; idx < ioen_nofCanMessages; idx++)
+        for (idx = 0; idx < ioen_canReset.nofPar; idx++)
+        {
+            memset (ioen_inParamBuffer + ioen_canReset.par[idx].offset, 0, ioen_canReset.par[idx].size);
+        }
+    }
+    else
     {
-        msgctrl_p = &ioen_mrcCanMessageControl[idx];
-        if (msgctrl_p->msgValidCtrl.cycle > 0)
+        msgcnt = ioen_iomConfig_p->canInputMessageCount;
+        msg_p  = CAN_INPUT_MSGINFO_FIRST(ioen_iomConfig_p);
+
+        /* reset all counter to 0, we will add the other values */
+        for (msgidx = 0; msgidx < msgcnt; msgidx++)
         {
-            /* Still fresh, decrement cycle counter */
-            msgctrl_p->msgValidCtrl.cycle--;
+            singleMap_p = (const simpleMapConfigCanIn_t *)(msg_p + 1);    /* mappings start directly after message */
 
-            if (msgctrl_p->msgValidCtrl.cycle == 0)
-            {
-                /* Message is not fresh, therefore confirmed lost    */
-                /* Process this message to invalidate its parameters */
-                ioen_imcInvalidateCanMessage (msgctrl_p);
-            }
-            else
+            for (mapidx = 0; mapidx < msg_p->numMappings; mapidx++)
             {
-                /* No action, as designed */
-                /* Message is still fresh */
+                if (singleMap_p->sigconfig.type == IOEN_INPUT_MAPPING_INT8_ADD)
+                {
+                    *((UInt32_t*)(ioen_inParamBufferSrc + singleMap_p->sigconfig.parOffset)) = 0;
+                    *((UInt32_t*)(ioen_inParamBuffer    + singleMap_p->parconfig.parOffset)) = 0;
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+
+                singleMap_p++;
             }
+
+            msg_p = CAN_INPUT_MSGINFO_NEXT(msg_p);
         }
-        else
-        {
-            /* No action, as defined   */
-            /* Message is unfresh      */
-        }
-                    
     }
-
 }
 
 
 
+
+
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imcNewMessage
+ *   ioen_imcFindSlot
  *
  * DESCRIPTION:
- *   This function filters out CAN Messages that are not different to its previous message.
- *   This is only performed on Pilot input message because the refresh rate is 10 to 20 ms.
- * 
- *   The CPs will always send unchanged messages with all data bytes == zero to the ARINC825,  
- *   when the pilot does not operate the CPs, but some of these messages are unnecessary to be 
- *   sent to host application. So the ARINC825 should set up a filter. 
- *   In general (except the specific case where the data of BARO Unit Selection in DCP is never 0, always 1 or 2), 
- *   the ARINC825 will discard the message when all data bytes of the message are 0,
- *   and the message data is identical to the previous message. Message filtering should 
- *   be restricted to the Pilot Input messages from the CPs.
- *
+ *   This function searches a masked CAN ID in the CAN ID hash table (open addressing, linear probing).
+ *   The table has at least twice as many slots as CAN messages, so it always contains an empty slot
+ *   and the probe sequence of a CAN ID is short.
  *
  * INTERFACE:
+ *   Global Data      :  ioen_canIdHash
+ *   Global Data      :  ioen_mrcCanMessageControl
  *
- *   In:  msgctrl_p      : Runtime control data for input message 
- *   In:  msg_p          : pointer to input message buffer
+ *   In:  canIdMasked : CAN ID without FS and RCI
  *
- *   Return: TRUE if the message has changed data from the last message
+ *   Return : Slot of the CAN ID, or the empty slot where the CAN ID is to be inserted
  *
  ******************************************************************/
-Bool_t ioen_imcNewMessage (
-    /* IN OUT */       CANMessageControl_t    * const msgctrl_p,
-    /* IN     */ const CANMessage_t           * const msg_p
+UInt32_t ioen_imcFindSlot (
+   /* IN     */ const UInt32_t                       canIdMasked
 )
 {
-    Bool_t  newMsg;
+    UInt32_t                  slot;
+    Bool_t                    found;
 
-    /* Check if data has changed */
-    
+    /* Multiplicative hash of the ID bits above FS and RCI, the top bits are the best mixed */
+    slot  = ((canIdMasked BIT_RSHIFT 4) * 0x9E3779B1U) BIT_RSHIFT IOEN_CAN_ID_HASH_SHIFT;
+    found = FALSE;
+
+    while ((found == FALSE) AND (ioen_canIdHash[slot] != IOEN_CAN_ID_HASH_EMPTY))
+    {
+        if (ioen_mrcCanMessageControl[ioen_canIdHash[slot]].canIdMasked == canIdMasked)
+        {
+            found = TRUE;
+        }
+        else
+        {
+            slot = (slot + 1) BIT_AND (IOEN_CAN_ID_HASH_SIZE - 1);
+        }
+    }
+
+    return (slot);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcLookupMessage
+ *
+ * DESCRIPTION:
+ *   This function looks up can ID in list of message configuration records
+ *   The CAN ID is searched in the hash table built by ioen_initCanControl,
+ *   the search time does not depend on the number of configured messages
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canIdHash
+ *   Global Data      :  ioen_mrcCanMessageControl
+ *
+ *   In:  canId       : CAN ID to read
+ *   Out: msgConfig_p : Pointer to configuration of this CAN ID, no match, return NULL
+ *   Out: msgCtrl_p   : Pointer to runtime data of this CAN ID, no match, return NULL
+ *
+ *
+ ******************************************************************/
+void ioen_imcLookupMessage (
+   /* IN     */ const UInt32_t                       canId,
+   /*    OUT */ const CanMessageConfig_t          ** msgConfig_p,
+   /*    OUT */       CANMessageControl_t         ** msgCtrl_p
+)
+{
+    UInt32_t                  idxCanId;
+
+    *msgConfig_p = (const CanMessageConfig_t *) 0;
+    *msgCtrl_p   = (CANMessageControl_t *) 0;
+
+    /* mask out  RCI, FS and unused top 3 bits */
+    idxCanId = ioen_canIdHash[ioen_imcFindSlot (canId BIT_AND A825_CAN_ID_IGNORE_FS_RCI_MASK)];
+
+    /* Get CAN Control runtime data */
+    if (idxCanId != IOEN_CAN_ID_HASH_EMPTY)
+    {
+        /* Configuration of the source (RCI), NULL if the source is not configured */
+        *msgCtrl_p   = &ioen_mrcCanMessageControl[idxCanId];
+        *msgConfig_p = ioen_mrcCanMessageControl[idxCanId].msgConfigSource_p[canId BIT_AND A825_CAN_ID_RCI_MASK];
+    }
+    else
+    {
+        /* No action as designed */
+        /* CAN ID not configured */
+    }
+
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcCheckMessageFreshness
+ *
+ * DESCRIPTION:
+ *   This function checks the freshness of the CAN messages due this cycle
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canFreshness
+ *   Global Data      :  ioen_mrcCanMessageControl
+ *
+ *
+ ******************************************************************/
+void ioen_imcCheckMessageFreshness (
+   /* IN     */ void
+)
+{
+    UInt32_t                  evIdx;
+    UInt32_t                  idx;
+
+    /* CAN messages are made fresh when received (ioen_frRearm), the events are unfresh messages only */
+    ioen_frUpdate (&ioen_canFreshness);
+
+    for (evIdx = 0; evIdx < ioen_canFreshness.nofEvents; evIdx++)
+    {
+        idx = ioen_canFreshness.event_p[evIdx];
+
+        if (ioen_frIsExpired (&ioen_canFreshness, idx) == TRUE)
+        {
+            /* Message is not fresh, therefore confirmed lost    */
+            /* Process this message to invalidate its parameters */
+            ioen_imcInvalidateCanMessage (&ioen_mrcCanMessageControl[idx]);
+        }
+        else
+        {
+            /* No action, as designed */
+            /* Message is still fresh */
+        }
+    }
+
+    ioen_frClearEvents (&ioen_canFreshness);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcWordMask
+ *
+ * DESCRIPTION:
+ *   This function returns the mask of one 64 bit word of the data bytes, for the first n data bytes of a CAN frame.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canLenMask
+ *
+ *   In:  nofBytes    : Number of leading data bytes
+ *   In:  wordIdx     : Index of the 64 bit word in the data bytes
+ *
+ *   Return : Mask of the word, in memory byte order
+ *
+ ******************************************************************/
+UInt64_t ioen_imcWordMask (
+    /* IN     */ const UInt32_t   nofBytes,
+    /* IN     */ const UInt32_t   wordIdx
+)
+{
+    UInt32_t  len;
+
+    if (nofBytes >= ((wordIdx + 1) * 8))
+    {
+        len = 8;
+    }
+    else if (nofBytes > (wordIdx * 8))
+    {
+        len = nofBytes - (wordIdx * 8);
+    }
+    else
+    {
+        len = 0;
+    }
+
+    return (ioen_canLenMask[len]);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcInitFilter
+ *
+ * DESCRIPTION:
+ *   This function resolves the frame filter of a CAN message from the filter rules of the application.
+ *   Messages without a rule are not filtered.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canFilterRules_p
+ *   Global Data      :  ioen_nofCanFilterRules
+ *   Global Data      :  ioen_canLenMask
+ *
+ *   In Out:  msgctrl_p : Runtime control data for input message, canIdMasked is set
+ *
+ ******************************************************************/
+void ioen_imcInitFilter (
+    /* IN OUT */       CANMessageControl_t    * const msgctrl_p
+)
+{
+    UInt32_t                ruleIdx;
+    UInt32_t                idleIdx;
+    UInt32_t                wordIdx;
+    UInt32_t                idKey;
+    const CanFilterRule_t  *rule_p;
+    CanFrameFilter_t       *filter_p;
+
+    filter_p = &msgctrl_p->filter;
+    idKey    = (msgctrl_p->canIdMasked BIT_RSHIFT 4) BIT_AND 0x00000FFF;
+
+    memset (filter_p, 0, sizeof(CanFrameFilter_t));
+
+    for (ruleIdx = 0; ruleIdx < ioen_nofCanFilterRules; ruleIdx++)
+    {
+        rule_p = &ioen_canFilterRules_p[ruleIdx];
+
+        if ((rule_p->idKey == idKey) AND (filter_p->enabled == FALSE))
+        {
+            filter_p->enabled   = TRUE;
+            filter_p->tailBytes = rule_p->tailBytes;
+            filter_p->nofIdle   = rule_p->nofIdle;
+
+            for (wordIdx = 0; wordIdx < IOEN_CAN_PAYLOAD_WORDS; wordIdx++)
+            {
+                filter_p->cmpMask[wordIdx] = ioen_imcWordMask (rule_p->cmpBytes, wordIdx);
+
+                for (idleIdx = 0; idleIdx < rule_p->nofIdle; idleIdx++)
+                {
+                    memcpy (&filter_p->idle[idleIdx][wordIdx], &rule_p->idle[idleIdx][wordIdx * 8], sizeof(UInt64_t));
+                    filter_p->idle[idleIdx][wordIdx] = filter_p->idle[idleIdx][wordIdx] BIT_AND filter_p->cmpMask[wordIdx];
+                }
+            }
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcNewMessage
+ *
+ * DESCRIPTION:
+ *   This function filters out CAN Messages that are not different to its previous message.
+ *   This is only performed on Pilot input message because the refresh rate is 10 to 20 ms.
+ * 
+ *   The CPs will always send unchanged messages with all data bytes == zero to the ARINC825,  
+ *   when the pilot does not operate the CPs, but some of these messages are unnecessary to be 
+ *   sent to host application. So the ARINC825 should set up a filter. 
+ *   In general (except the specific case where the data of BARO Unit Selection in DCP is never 0, always 1 or 2), 
+ *   the ARINC825 will discard the message when all data bytes of the message are 0,
+ *   and the message data is identical to the previous message. Message filtering should 
+ *   be restricted to the Pilot Input messages from the CPs.
+ *
+ *
+ *   The filter of each message is resolved from the rules of ioen_setCanFilterRules at start up,
+ *   a frame is compared with its previous frame in masked 64 bit words, one word for a classic CAN frame
+ *   and up to IOEN_CAN_PAYLOAD_WORDS words for a CAN FD frame.
+ *
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canLenMask
+ *
+ *   In:  msgctrl_p      : Runtime control data for input message 
+ *   In:  msg_p          : pointer to input message buffer
+ *
+ *   Return: TRUE if the message has changed data from the last message
+ *
+ ******************************************************************/
+Bool_t ioen_imcNewMessage (
+    /* IN OUT */       CANMessageControl_t    * const msgctrl_p,
+    /* IN     */ const CANMessage_t           * const msg_p
+)
+{
+    Bool_t                   newMsg;
+    UInt32_t                 len;
+    UInt32_t                 nofWords;
+    UInt32_t                 wordIdx;
+    UInt32_t                 idleIdx;
+    UInt64_t                 mask;
+    UInt64_t                 curData;
+    UInt64_t                 prevData;
+    UInt64_t                 changed;
+    UInt64_t                 notIdle[IOEN_CAN_FILTER_MAX_IDLE];
+    const CanFrameFilter_t  *filter_p;
+
+    filter_p = &msgctrl_p->filter;
+
+    /* Check if data has changed */
+    
     if (   (msg_p->canId  != msgctrl_p->prevMsg.canId)
         OR (msg_p->nbytes != msgctrl_p->prevMsg.nbytes)
+        OR (filter_p->enabled == FALSE)
        )
     {
-        /* FS or size Changed */
+        /* FS or size Changed, or no filtering for this message */
         newMsg = TRUE;
     }
     else
     {
-        /* Remove RCI, FS and common bits (bottom 4 bits) for CAN ID search */
-        switch ((msg_p->canId BIT_RSHIFT 4) BIT_AND 0x00000FFF)
-        {
-            case 0x200:
-            case 0x240:
-                /* 0x08482004 */
-                /* 0x08482005 */
-                /* 0x08482404 */
-                /* 0x08482405 */
-                /* the frame content is:                                     */
-                /*   data[0] == 0 ,data[1] == 0 , data[3] == 0 ,data[4] == 0 */
-                /*   data[2] == 1 or 2                                       */
-                /*   data[5] == Validity, data[6] == HeartBeat               */
-                /*   Do not use Validity or HeartBeat for filtering          */
-
-                if (memcmp (&msg_p->data[0], &msgctrl_p->prevMsg.data[0], 5) != 0)
-                {
-                    /* Different data */
-                    newMsg = TRUE;
-                }
-                else
-                {
-                    if (ioen_UtilIsZero (&msg_p->data[0], 5) == TRUE)
-                    {
-                        /* New and Old data is 0, Discard, empty (unchanged data from LRU) */
-                        newMsg = FALSE;
-                    }
-                    else
-                    {
-                        if (    (msg_p->data[2] == 1 OR  msg_p->data[2] == 2)
-                            AND (msg_p->data[0] == 0 AND msg_p->data[1] == 0 AND msg_p->data[3] == 0 AND msg_p->data[4] == 0 )
-                           )
-                        {
-                            /* Discard */
-                            newMsg = FALSE;
-                        }
-                        else
-                        {
-                            newMsg = TRUE;
-                        }
+        /* Compared bytes, without the trailing validity and heartbeat bytes */
+        if (msg_p->nbytes > (UInt16_t)(IOEN_CAN_MAX_PAYLOAD + filter_p->tailBytes))
+        {
+            len = IOEN_CAN_MAX_PAYLOAD;
+        }
+        else if (msg_p->nbytes > filter_p->tailBytes)
+        {
+            len = msg_p->nbytes - filter_p->tailBytes;
+        }
+        else
+        {
+            len = 0;
+        }
 
-                    }
-                }
-                break;
+        /* Only the words with compared bytes, one word for a classic CAN frame */
+        nofWords = (len + 7) / 8;
+        changed  = 0;
 
-            case 0x000:
-            case 0x040:
-            case 0x100:
-            case 0x140:
-            case 0x300:
-                /* 0x08480004 */
-                /* 0x08480005 */
-                /* 0x08480404 */
-                /* 0x08480405 */
-                /* 0x08481004 */
-                /* 0x08481005 */
-                /* 0x08481404 */
-                /* 0x08481405 */
-                /* 0x08483004 */
-                /* 0x08483005 */
-                /* Do not include validity and heartbeat in filter */
-                if (   (memcmp (&msg_p->data[0], &msgctrl_p->prevMsg.data[0], msg_p->nbytes - 2) != 0)
-                    OR (ioen_UtilIsZero (&msg_p->data[0], msg_p->nbytes - 2) == FALSE)
-                   )
-                {
-                    /* Different data OR data is non zero, eg. a count operation to be added to the output */
-                    newMsg = TRUE;
-                }
-                else
-                {
-                    newMsg = FALSE;
-                }
-                break;
+        for (idleIdx = 0; idleIdx < IOEN_CAN_FILTER_MAX_IDLE; idleIdx++)
+        {
+            notIdle[idleIdx] = 0;
+        }
 
-            case 0x201:
-            case 0x241:
-                /* 0x8482014 */
-                /* 0x8482015 */
-                /* 0x8482414 */
-                /* 0x8482415 */
-                /* There is no validity and heartbeat in these messages */
-                if (   (memcmp (&msg_p->data[0], &msgctrl_p->prevMsg.data[0], msg_p->nbytes) != 0)
-                    OR (ioen_UtilIsZero (&msg_p->data[0], msg_p->nbytes) == FALSE)
-                   )
+        for (wordIdx = 0; wordIdx < nofWords; wordIdx++)
+        {
+            mask = filter_p->cmpMask[wordIdx] BIT_AND ioen_imcWordMask (len, wordIdx);
+
+            memcpy (&curData,  &msg_p->data[wordIdx * 8],              sizeof(UInt64_t));
+            memcpy (&prevData, &msgctrl_p->prevMsg.data[wordIdx * 8], sizeof(UInt64_t));
+
+            curData  = curData  BIT_AND mask;
+            prevData = prevData BIT_AND mask;
+            changed  = changed  BIT_OR (curData BIT_XOR prevData);
+
+            for (idleIdx = 0; idleIdx < filter_p->nofIdle; idleIdx++)
+            {
+                notIdle[idleIdx] = notIdle[idleIdx] BIT_OR (curData BIT_XOR (filter_p->idle[idleIdx][wordIdx] BIT_AND mask));
+            }
+        }
+
+        if (changed != 0)
+        {
+            /* Different data */
+            newMsg = TRUE;
+        }
+        else
+        {
+            /* Unchanged data, discard it if it is idle (unchanged data from LRU), */
+            /* otherwise eg. a count operation to be added to the output           */
+            newMsg = TRUE;
+            for (idleIdx = 0; idleIdx < filter_p->nofIdle; idleIdx++)
+            {
+                if (notIdle[idleIdx] == 0)
                 {
-                    /* Different data OR data is non zero, eg. a count operation to be added to the output */
-                    newMsg = TRUE;
+                    /* Discard */
+                    newMsg = FALSE;
                 }
                 else
                 {
-                    newMsg = FALSE;
+                    /* No action as designed */
                 }
-                break;
-
-            default:
-                /* No filtering for other messages */
-                newMsg = TRUE;
-                break;
+            }
         }
     }
     
@@ -576,209 +1062,779 @@ Bool_t ioen_imcNewMessage (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_imcHandleBus
+ *   ioen_imcHandleFrames
  *
  * DESCRIPTION:
- *   This function processes data from one bus, it reads all queued messages from the device (up to 32)
+ *   This function processes the CAN messages of one read from a bus
  *      For each message
  *         look it up by can id
  *         if bus is the current bus for the message or the message has not been received (on the other bus) for a timeout period,
  *         process it, otherwise discard it.
+ *         add it to the routing list, if it has to be routed to another partition
  *      Note: This mechanism will switch the receiving bus for a message on a permanent or temporary failure. The bus will only be
  *      switched back by after a temporary or permanent failure of the second failure.
  *
  * INTERFACE:
- *   Global Data      :  ioen_mrcCycle_count
  *   Global Data      :  ioen_mrcCanMessageControl
+ *   Global Data      :  ioen_canFreshness
  *   Global Data      :  ioen_mrcConfigRoutingTable_p
  *
- *   In: apexCanBusId : APEX port ID used to read from
+ *   In:      busIdx        : Index of the bus the messages were read from
+ *   In Out:  canMsgBuffer_p: CAN messages, the CAN ID is converted to host byte order
+ *   In:      arrival_p     : Arrival time per CAN message
+ *   In:      nofCanMsg     : Number of CAN messages
  *
  ******************************************************************/
-void ioen_imcHandleBus (
-   /* IN     */ const SInt32_t   apexCanBusId
+void ioen_imcHandleFrames (
+   /* IN     */ const UInt32_t                 busIdx,
+   /* IN OUT */       CANMessage_t     * const canMsgBuffer_p,
+   /* IN     */ const SYSTEM_TIME_TYPE * const arrival_p,
+   /* IN     */ const UInt32_t                 nofCanMsg
 )
 {
     Bool_t                    newMsg;
-    UInt32_t                  nofCanMsg;
-    MESSAGE_SIZE_TYPE         len;           /* message length from low level CAN driver, multiple of CANMessage_t */
-    RETURN_CODE_TYPE          ret;           /* return value from APEX calls */
     UInt32_t                  portIdx;
     UInt32_t                  msgIdx;
+    UInt32_t                  ctrlIdx;       /* index of the message control data */
     CANMessage_t             *canMsg_p;      /* pointer to one message */
     CANMessageControl_t      *msgCtrl_p;
     IOMCanRoutingPortTbl_t   *iomCanPort;
     const CanMessageConfig_t *msginfo_p;     /* pointer to processed corresponding message info structure */
-    CANMessage_t              inCanMsgBuffer[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];
 
     msginfo_p   = (const CanMessageConfig_t *) 0;
     msgCtrl_p   = (CANMessageControl_t *) 0;
 
-    /* Read all CAN messages from the given CAN bus */
-    RECEIVE_QUEUING_MESSAGE(apexCanBusId, (SYSTEM_TIME_TYPE)0, (MESSAGE_ADDR_TYPE)&inCanMsgBuffer[0], &len, &ret);
-    CHECK_CODE("RECEIVE_CAN_MESSAGE", ret);
-
-    if ((len > 0) AND (ret == NO_ERROR))
+    for (msgIdx = 0; msgIdx < nofCanMsg; msgIdx++)
     {
-        nofCanMsg = len / sizeof(CANMessage_t);
+        canMsg_p = &canMsgBuffer_p[msgIdx];
+
+        /* Convert the byte order of the CAN ID, if required */
+        canMsg_p->canId = HTON32(canMsg_p->canId);
 
-        for (msgIdx = 0; msgIdx < nofCanMsg; msgIdx++)
+        /* find the message configuration, by looking up the CAN ID */
+        ioen_imcLookupMessage(canMsg_p->canId, &msginfo_p, &msgCtrl_p);
+
+        if ((msginfo_p) AND (msgCtrl_p))
         {
-            canMsg_p = &inCanMsgBuffer[msgIdx];
+            /* Message is configured */
+            ctrlIdx = (UInt32_t)(msgCtrl_p - &ioen_mrcCanMessageControl[0]);
 
-            /* Convert the byte order of the CAN ID, if required */
-            canMsg_p->canId = HTON32(canMsg_p->canId);
+            if (    /* Message on same bus, use it without changing source selection */
+                   (msgCtrl_p->lastBus == busIdx)
 
-            /* find the message configuration, by looking up the CAN ID */
-            ioen_imcLookupMessage(canMsg_p->canId, &msginfo_p, &msgCtrl_p);
+                    /* First time, use it */
+                OR ((msgCtrl_p->lastBus == IOEN_CAN_BUS_NONE))
 
-            if ((msginfo_p) AND (msgCtrl_p))
+                    /* Current message on the selected source has timed out, */
+                    /* The message has been received on another bus,         */
+                    /* change source to select message from this bus         */
+                OR (ioen_frIsExpired (&ioen_canFreshness, ctrlIdx) == TRUE)
+               )
             {
-                /* Message is configured */
+                /* Process current CAN bus message if:                                         */
+                /*   1. This is the currently selected CAN bus for this message                */
+                /*   OR                                                                        */
+                /*   2. There is no message on the currently selected CAN bus for longer than  */
+                /*      (n * messages rate), and there is a good message on another CAN bus.   */
 
-                if (    /* Message on same bus, use it without changing source selection */
-                       (msgCtrl_p->lastbus == apexCanBusId)
+                msgCtrl_p->lastArrival = arrival_p[msgIdx];
 
-                        /* First time, use it, zero is not valid for an APEX port ID (QUEUING_PORT_ID_TYPE) */
-                    OR ((msgCtrl_p->lastbus == 0))
+                if (msgCtrl_p->lastBus != busIdx)
+                {
+                    /* Change of source selection, process the message */
+                    newMsg = TRUE;
+                }
+                else
+                {
+                    /* Check if new Message was received */
+                    newMsg = ioen_imcNewMessage(msgCtrl_p, canMsg_p);
+                }
 
-                        /* Current message on the selected source has timed out, */
-                        /* The message has been received on the other bus,       */
-                        /* change source to select message from the other bus    */
-                    OR (msgCtrl_p->msgValidCtrl.cycle == 0)
-                   )
+                if (newMsg == TRUE)
                 {
-                    /* Process current CAN bus message if:                                         */
-                    /*   1. This is the currently selected CAN bus for this message                */
-                    /*   OR                                                                        */
-                    /*   2. There is no message on the currently selected CAN bus for longer than  */
-                    /*      (n * messages rate), and there is a good message on the other CAN bus. */
+                    /* Save new message for filtering next time */
+                    memcpy (&msgCtrl_p->prevMsg, canMsg_p, sizeof(CANMessage_t));
+
+                    /* Validate and route all CAN signals for this message */
+                    ioen_imcProcessCanMessage(msgCtrl_p, msginfo_p, canMsg_p);
 
-                    if (msgCtrl_p->lastbus != apexCanBusId)
+                    if (msgCtrl_p->msgValidCtrl.validity.current.value == IOEN_GLOB_DATA_VALID)
                     {
-                        /* Change of source selection, process the message */
-                        newMsg = TRUE;
+                        /* Set this CAN bus as the currently selected bus for this message, and reset the timeout */
+                        msgCtrl_p->lastBus            = (Byte_t)busIdx;
+                        ioen_frRearm (&ioen_canFreshness, ctrlIdx);  /* Message is fresh, reset the deadline */
                     }
                     else
                     {
-                        /* Check if new Message was received */
-                        newMsg = ioen_imcNewMessage(msgCtrl_p, canMsg_p);
+                        /* No action, as designed                     */
+                        /* Message was invalid, do not reset counters */
                     }
 
-                    if (newMsg == TRUE)
+                }
+                else
+                {
+                    /* message is filtered, update its freshness */
+                    if (msgCtrl_p->msgValidCtrl.validity.current.value == IOEN_GLOB_DATA_VALID)
                     {
-                        /* Save new message for filtering next time */
-                        memcpy (&msgCtrl_p->prevMsg, canMsg_p, sizeof(CANMessage_t));
-
-                        /* Validate and route all CAN signals for this message */
-                        ioen_imcProcessCanMessage(msgCtrl_p, msginfo_p, canMsg_p);
-
-                        if (msgCtrl_p->msgValidCtrl.validity.current.value == IOEN_GLOB_DATA_VALID)
-                        {
-                            /* Set this CAN bus as the currently selected bus for this message, and reset the timeout */
-                            msgCtrl_p->lastbus            = apexCanBusId;
-                            msgCtrl_p->msgValidCtrl.cycle = msgCtrl_p->msgValidCtrl.limitCycleInvalid;  /* Message is fresh, reset the counter */
-                        }
-                        else
-                        {
-                            /* No action, as designed                     */
-                            /* Message was invalid, do not reset counters */
-                        }
-
+                        /* Message is still fresh, reset the deadline */
+                        ioen_frRearm (&ioen_canFreshness, ctrlIdx);
                     }
                     else
                     {
-                        /* message is filtered, update its freshness */
-                        if (msgCtrl_p->msgValidCtrl.validity.current.value == IOEN_GLOB_DATA_VALID)
-                        {
-                            /* Message is still fresh, reset the counter */
-                            msgCtrl_p->msgValidCtrl.cycle = msgCtrl_p->msgValidCtrl.limitCycleInvalid;
-                        }
-                        else
-                        {
-                            /* No action as designed */
-                            /* Filtered message is still invalid */
-                        }
-
+                        /* No action as designed */
+                        /* Filtered message is still invalid */
                     }
 
                 }
-                else
-                {
-                    /* else message is discarded */
-                }
+
             }
             else
             {
-                /* else message is discarded if not re-routed*/
+                /* else message is discarded */
             }
+        }
+        else
+        {
+            /* else message is discarded if not re-routed*/
+        }
 
-            /* Check if the message has to be routed to another partition */
-            portIdx    = 0;
-            iomCanPort = &ioen_mrcConfigRoutingTable_p[0];
+        /* Check if the message has to be routed to another partition */
+        portIdx    = 0;
+        iomCanPort = &ioen_mrcConfigRoutingTable_p[0];
 
-            while (iomCanPort->canType != IOEN_CAN_PORT_TYPE_TERMINATOR)
+        while (iomCanPort->canType != IOEN_CAN_PORT_TYPE_TERMINATOR)
+        {
+            /* Remove FS from CAN ID before comparision */
+            if (    ((canMsg_p->canId BIT_AND A825_CAN_ID_IGNORE_FS_MASK) == (iomCanPort->canId BIT_AND A825_CAN_ID_IGNORE_FS_MASK) )
+                AND (iomCanPort->canType == IOEN_CAN_PORT_TYPE_ROUTING_TX)
+               )
             {
-                /* Remove FS from CAN ID before comparision */
-                if (    ((canMsg_p->canId BIT_AND A825_CAN_ID_IGNORE_FS_MASK) == (iomCanPort->canId BIT_AND A825_CAN_ID_IGNORE_FS_MASK) )
-                    AND (iomCanPort->canType == IOEN_CAN_PORT_TYPE_ROUTING_TX)
-                   )
+                /* Add to the list of the APEX port, the message stays in the receive buffer */
+                iomCanPort = &ioen_mrcConfigRoutingTable_p[iomCanPort->ownerIdx];
+
+                if (iomCanPort->nofOutMsg < IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
                 {
-                    if (iomCanPort->nofOutMsg < IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
-                    {
-                        /* Add to list to send on a Queuing Port */
-                        memcpy (&iomCanPort->outMsg[iomCanPort->nofOutMsg], canMsg_p, sizeof(CANMessage_t));
-                        iomCanPort->nofOutMsg++;
-                    }
-                    else
-                    {
-                        /* No action as designed */
-                        /* iomCanPort->nofOutMsg is set to zero at the start of each IOM cycle */
-                        /* and incremented only as above */
-                    }
-                    break;
+                    iomCanPort->outIdx[iomCanPort->nofOutMsg] = (Byte_t)msgIdx;
+                    iomCanPort->nofOutMsg++;
                 }
                 else
                 {
                     /* No action as designed */
+                    /* iomCanPort->nofOutMsg is set to zero after each send */
+                    /* and incremented only as above */
                 }
-                portIdx++;
-                iomCanPort = &ioen_mrcConfigRoutingTable_p[portIdx];
+                break;
             }
+            else
+            {
+                /* No action as designed */
+            }
+            portIdx++;
+            iomCanPort = &ioen_mrcConfigRoutingTable_p[portIdx];
         }
+    }
+}
 
-        /* Transmit any CAN Messages configured to be routed to another IOM application */
-        portIdx    = 0;
-        iomCanPort = &ioen_mrcConfigRoutingTable_p[0];
-        while (iomCanPort->canType != IOEN_CAN_PORT_TYPE_TERMINATOR)
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcSendRoutedMessages
+ *
+ * DESCRIPTION:
+ *   This function sends the CAN messages in the routing lists to the other partitions, and clears the lists
+ *   The lists hold indexes into the receive buffer, each APEX port is sent with one call.
+ *   A list of consecutive messages is sent directly from the receive buffer,
+ *   otherwise the messages are gathered into one buffer first.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_mrcConfigRoutingTable_p
+ *
+ *   In:  canMsgBuffer_p : CAN messages of the read, as processed by ioen_imcHandleFrames
+ *
+ ******************************************************************/
+void ioen_imcSendRoutedMessages (
+   /* IN     */ const CANMessage_t     * const canMsgBuffer_p
+)
+{
+    RETURN_CODE_TYPE          ret;           /* return value from APEX calls */
+    UInt32_t                  portIdx;
+    UInt32_t                  outIdx;
+    Bool_t                    consecutive;
+    IOMCanRoutingPortTbl_t   *iomCanPort;
+    const CANMessage_t       *sendBuffer_p;
+    CANMessage_t              gatherBuffer[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];
+
+    /* Transmit any CAN Messages configured to be routed to another IOM application */
+    portIdx    = 0;
+    iomCanPort = &ioen_mrcConfigRoutingTable_p[0];
+    while (iomCanPort->canType != IOEN_CAN_PORT_TYPE_TERMINATOR)
+    {
+        if (iomCanPort->nofOutMsg > 0)
+        {
+            consecutive = TRUE;
+            for (outIdx = 1; outIdx < (UInt32_t)iomCanPort->nofOutMsg; outIdx++)
+            {
+                if (iomCanPort->outIdx[outIdx] != (iomCanPort->outIdx[0] + outIdx))
+                {
+                    consecutive = FALSE;
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+            }
+
+            if (consecutive == TRUE)
+            {
+                /* Send directly from the receive buffer */
+                sendBuffer_p = &canMsgBuffer_p[iomCanPort->outIdx[0]];
+            }
+            else
+            {
+                for (outIdx = 0; outIdx < (UInt32_t)iomCanPort->nofOutMsg; outIdx++)
+                {
+                    memcpy (&gatherBuffer[outIdx], &canMsgBuffer_p[iomCanPort->outIdx[outIdx]], sizeof(CANMessage_t));
+                }
+                sendBuffer_p = &gatherBuffer[0];
+            }
+
+            /* Send Message on a Queuing Port */
+            SEND_QUEUING_MESSAGE   (iomCanPort->apexCanBusId, 
+                                    (MESSAGE_ADDR_TYPE)sendBuffer_p,
+                                    (sizeof(CANMessage_t) * iomCanPort->nofOutMsg),
+                                    0,
+                                    &ret);
+            CHECK_CODE("SEND_QUEUING_MESSAGE", ret);
+
+            iomCanPort->nofOutMsg = 0;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+        portIdx++;
+        iomCanPort = &ioen_mrcConfigRoutingTable_p[portIdx];
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcFillRing
+ *
+ * DESCRIPTION:
+ *   This function is the producer of the receive ring of one bus, it runs in the reader process.
+ *   The queued messages are read from the device and copied to the ring with the time of the read.
+ *   The bus is read until it is empty, IOEN_CAN_MAX_DRAIN_READS reads were performed, or the ring
+ *   has no room for a full read. The messages then stay in the driver queue until the cycle has
+ *   taken messages from the ring, nothing is overwritten.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canRxRing
+ *
+ *   In: apexCanBusId : APEX port ID used to read from
+ *   In: busIdx       : Index of the bus in ioen_apexCanBusIdRx
+ *
+ ******************************************************************/
+void ioen_imcFillRing (
+   /* IN     */ const SInt32_t   apexCanBusId,
+   /* IN     */ const UInt32_t   busIdx
+)
+{
+    Bool_t                    readMore;
+    UInt32_t                  head;
+    UInt32_t                  slot;
+    UInt32_t                  msgIdx;
+    UInt32_t                  nofCanMsg;
+    UInt32_t                  nofReads;
+    MESSAGE_SIZE_TYPE         len;           /* message length from low level CAN driver, multiple of CANMessage_t */
+    RETURN_CODE_TYPE          ret;           /* return value from APEX calls */
+    SYSTEM_TIME_TYPE          now;
+    CanRxRing_t              *ring_p;
+    CANMessage_t              inCanMsgBuffer[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];
+
+    ring_p   = &ioen_canRxRing[busIdx];
+    nofReads = 0;
+
+    do
+    {
+        head = ring_p->head;
+
+        if ((IOEN_CAN_RING_SIZE - (head - ring_p->tail)) >= IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
+        {
+            RECEIVE_QUEUING_MESSAGE(apexCanBusId, (SYSTEM_TIME_TYPE)0, (MESSAGE_ADDR_TYPE)&inCanMsgBuffer[0], &len, &ret);
+            CHECK_CODE("RECEIVE_CAN_MESSAGE", ret);
+            nofReads++;
+
+            if ((len > 0) AND (ret == NO_ERROR))
+            {
+                GET_TIME (&now, &ret);
+                nofCanMsg = len / sizeof(CANMessage_t);
+
+                for (msgIdx = 0; msgIdx < nofCanMsg; msgIdx++)
+                {
+                    slot = (head + msgIdx) BIT_AND (IOEN_CAN_RING_SIZE - 1);
+
+                    memcpy (&ring_p->frame[slot], &inCanMsgBuffer[msgIdx], sizeof(CANMessage_t));
+                    ring_p->arrival[slot] = now;
+                }
+
+                /* The messages must be visible before the new head */
+                IOEN_MEMORY_BARRIER();
+                ring_p->head = head + nofCanMsg;
+
+                readMore = (nofReads < IOEN_CAN_MAX_DRAIN_READS);
+            }
+            else
+            {
+                /* No action as designed        */
+                /* No messages received, empty  */
+                readMore = FALSE;
+            }
+        }
+        else
+        {
+            /* Ring full, the cycle is behind */
+            ring_p->fullStops++;
+            readMore = FALSE;
+        }
+    } while (readMore == TRUE);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcTakeRing
+ *
+ * DESCRIPTION:
+ *   This function is the consumer of the receive ring of one bus, it runs in the IOM cycle.
+ *   It takes up to IOEN_MAX_CAN_MESSAGES_PER_CYCLE messages with their arrival time from the ring.
+ *   The messages are copied, the slots are released before they are processed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canRxRing
+ *
+ *   In:   busIdx         : Index of the bus in ioen_apexCanBusIdRx
+ *   Out:  canMsgBuffer_p : CAN messages, up to IOEN_MAX_CAN_MESSAGES_PER_CYCLE
+ *   Out:  arrival_p      : Arrival time per CAN message
+ *
+ *   Return : Number of CAN messages taken
+ *
+ ******************************************************************/
+UInt32_t ioen_imcTakeRing (
+   /* IN     */ const UInt32_t                 busIdx,
+   /*    OUT */       CANMessage_t     * const canMsgBuffer_p,
+   /*    OUT */       SYSTEM_TIME_TYPE * const arrival_p
+)
+{
+    UInt32_t                  tail;
+    UInt32_t                  slot;
+    UInt32_t                  msgIdx;
+    UInt32_t                  nofCanMsg;
+    CanRxRing_t              *ring_p;
+
+    ring_p    = &ioen_canRxRing[busIdx];
+    tail      = ring_p->tail;
+    nofCanMsg = ring_p->head - tail;
+
+    /* The head must be read before the messages */
+    IOEN_MEMORY_BARRIER();
+
+    if (nofCanMsg > IOEN_MAX_CAN_MESSAGES_PER_CYCLE)
+    {
+        nofCanMsg = IOEN_MAX_CAN_MESSAGES_PER_CYCLE;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    for (msgIdx = 0; msgIdx < nofCanMsg; msgIdx++)
+    {
+        slot = (tail + msgIdx) BIT_AND (IOEN_CAN_RING_SIZE - 1);
+
+        memcpy (&canMsgBuffer_p[msgIdx], &ring_p->frame[slot], sizeof(CANMessage_t));
+        arrival_p[msgIdx] = ring_p->arrival[slot];
+    }
+
+    /* The messages must be copied before the slots are released */
+    IOEN_MEMORY_BARRIER();
+    ring_p->tail = tail + nofCanMsg;
+
+    return (nofCanMsg);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_imcHandleBus
+ *
+ * DESCRIPTION:
+ *   This function processes data from one bus, it reads the queued messages from the device (up to 64 per read)
+ *   and routes the messages configured for another partition after each read.
+ *   Without drain mode, one read is performed per cycle.
+ *   In drain mode, the queue is read until it is empty or the frame or time budget of the bus is used up,
+ *   a backlog is not delayed to the next cycle. The queue depth and the frames per cycle are recorded as high-water marks.
+ *   With the reader enabled, the messages are taken from the receive ring instead of the device,
+ *   the ring is emptied like the queue in drain mode. Validation, filtering and freshness are unchanged.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canDrain
+ *   Global Data      :  ioen_canRxRing
+ *
+ *   In: apexCanBusId : APEX port ID used to read from
+ *   In: busIdx       : Index of the bus in ioen_apexCanBusIdRx, 0 = bus A, 1 = bus B
+ *
+ ******************************************************************/
+void ioen_imcHandleBus (
+   /* IN     */ const SInt32_t   apexCanBusId,
+   /* IN     */ const UInt32_t   busIdx
+)
+{
+    Bool_t                    drain;
+    Bool_t                    readMore;
+    UInt32_t                  msgIdx;
+    UInt32_t                  nofCanMsg;
+    UInt32_t                  nofFrames;
+    UInt32_t                  nofReads;
+    UInt32_t                  depth;
+    MESSAGE_SIZE_TYPE         len;           /* message length from low level CAN driver, multiple of CANMessage_t */
+    RETURN_CODE_TYPE          ret;           /* return value from APEX calls */
+    SYSTEM_TIME_TYPE          startTime;
+    SYSTEM_TIME_TYPE          now;
+    QUEUING_PORT_STATUS_TYPE  status;
+    CanBusStatistics_t       *stats_p;
+    CANMessage_t              inCanMsgBuffer[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];
+    SYSTEM_TIME_TYPE          arrival[IOEN_MAX_CAN_MESSAGES_PER_CYCLE];
+
+    stats_p   = &ioen_canDrain.stats[busIdx];
+    drain     = (ioen_canDrain.enabled == TRUE) OR (ioen_canDrain.reader == TRUE);
+    nofFrames = 0;
+    nofReads  = 0;
+    depth     = 0;
+    startTime = 0;
+
+    if (ioen_canDrain.reader == TRUE)
+    {
+        /* Ring depth before the first read, in CAN messages */
+        depth = ioen_canRxRing[busIdx].head - ioen_canRxRing[busIdx].tail;
+    }
+    else
+    {
+        if (ioen_canDrain.enabled == TRUE)
         {
-            if (iomCanPort->nofOutMsg > 0)
+            /* Queue depth before the first read, in driver messages */
+            GET_QUEUING_PORT_STATUS (apexCanBusId, &status, &ret);
+            CHECK_CODE("GET_QUEUING_PORT_STATUS", ret);
+
+            if (ret == NO_ERROR)
             {
-                /* Send Message on a Queuing Port */
-                SEND_QUEUING_MESSAGE   (iomCanPort->apexCanBusId, 
-                                        (MESSAGE_ADDR_TYPE)&iomCanPort->outMsg[0],
-                                        (sizeof(CANMessage_t) * iomCanPort->nofOutMsg),
-                                        0,
-                                        &ret);
-                CHECK_CODE("RECEIVE_QUEUING_MESSAGE", ret);
-
-                iomCanPort->nofOutMsg = 0;
+                depth = (UInt32_t)status.NB_MESSAGE;
             }
             else
             {
                 /* No action as designed */
             }
-            portIdx++;
-            iomCanPort = &ioen_mrcConfigRoutingTable_p[portIdx];
         }
+        else
+        {
+            /* No action as designed */
+        }
+    }
 
+    if (depth > stats_p->queueDepthHwm)
+    {
+        stats_p->queueDepthHwm = depth;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+
+    if (drain == TRUE)
+    {
+        GET_TIME (&startTime, &ret);
     }
     else
     {
         /* No action as designed */
-        /* No messages received  */
     }
 
+    do
+    {
+        if (ioen_canDrain.reader == TRUE)
+        {
+            /* Take the CAN messages queued by the reader */
+            nofCanMsg = ioen_imcTakeRing (busIdx, &inCanMsgBuffer[0], &arrival[0]);
+        }
+        else
+        {
+            /* Read the queued CAN messages from the given CAN bus */
+            RECEIVE_QUEUING_MESSAGE(apexCanBusId, (SYSTEM_TIME_TYPE)0, (MESSAGE_ADDR_TYPE)&inCanMsgBuffer[0], &len, &ret);
+            CHECK_CODE("RECEIVE_CAN_MESSAGE", ret);
+
+            if ((len > 0) AND (ret == NO_ERROR))
+            {
+                nofCanMsg = len / sizeof(CANMessage_t);
+
+                /* All messages of one read arrive at the time of the read */
+                GET_TIME (&now, &ret);
+
+                for (msgIdx = 0; msgIdx < nofCanMsg; msgIdx++)
+                {
+                    arrival[msgIdx] = now;
+                }
+            }
+            else
+            {
+                nofCanMsg = 0;
+            }
+        }
+        nofReads++;
+
+        if (nofCanMsg > 0)
+        {
+            nofFrames += nofCanMsg;
+
+            ioen_imcHandleFrames (busIdx, &inCanMsgBuffer[0], &arrival[0], nofCanMsg);
+
+            /* Transmit any CAN Messages configured to be routed to another IOM application */
+            ioen_imcSendRoutedMessages (&inCanMsgBuffer[0]);
+
+            readMore = drain;
+        }
+        else
+        {
+            /* No action as designed        */
+            /* No messages received, empty  */
+            readMore = FALSE;
+        }
+
+        if (readMore == TRUE)
+        {
+            GET_TIME (&now, &ret);
+
+            if (   (nofReads >= IOEN_CAN_MAX_DRAIN_READS)
+                OR ((ioen_canDrain.frameBudget > 0) AND (nofFrames >= ioen_canDrain.frameBudget))
+                OR ((ioen_canDrain.timeBudget  > 0) AND ((now - startTime) >= ioen_canDrain.timeBudget))
+               )
+            {
+                /* Budget used up, the rest of the queue is read in the next cycle */
+                stats_p->budgetStops++;
+                readMore = FALSE;
+            }
+            else
+            {
+                /* No action as designed */
+            }
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    } while (readMore == TRUE);
+
+    if (nofFrames > stats_p->framesHwm)
+    {
+        stats_p->framesHwm = nofFrames;
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setCanFilterRules
+ *
+ * DESCRIPTION:
+ *   This function sets the filter rules of the CAN frames, e.g. the idle patterns of the "Pilot Input"
+ *   messages of the CPs. The rules are resolved per CAN message in ioen_createPorts, so they must be set before,
+ *   and the table must stay valid. Without rules no CAN frame is filtered.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canFilterRules_p
+ *   Global Data      :  ioen_nofCanFilterRules
+ *
+ *   In:  rules_p     : Filter rules, NULL = no filtering
+ *   In:  nofRules    : Number of rules
+ *
+ ******************************************************************/
+void ioen_setCanFilterRules (
+   /* IN     */ const CanFilterRule_t        * const rules_p,
+   /* IN     */ const UInt32_t                       nofRules
+)
+{
+    if (rules_p != NULL_PTR)
+    {
+        ioen_canFilterRules_p  = rules_p;
+        ioen_nofCanFilterRules = nofRules;
+    }
+    else
+    {
+        ioen_canFilterRules_p  = NULL_PTR;
+        ioen_nofCanFilterRules = 0;
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setCanDrain
+ *
+ * DESCRIPTION:
+ *   This function switches the drain mode of the CAN receive on or off, and sets the budget per bus and cycle.
+ *   The budgets are checked after each read, a read returns up to IOEN_MAX_CAN_MESSAGES_PER_CYCLE messages.
+ *   At most IOEN_CAN_MAX_DRAIN_READS reads are performed per bus and cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canDrain
+ *
+ *   In:  enable      : TRUE = read until the queue is empty or the budget is used up, FALSE = one read per cycle
+ *   In:  frameBudget : Maximum number of CAN messages per bus and cycle, 0 = no limit
+ *   In:  timeBudget  : Maximum read time per bus and cycle in nanoseconds, 0 = no limit
+ *
+ ******************************************************************/
+void ioen_setCanDrain (
+   /* IN     */ const Bool_t                 enable,
+   /* IN     */ const UInt32_t               frameBudget,
+   /* IN     */ const UInt32_t               timeBudget
+)
+{
+    ioen_canDrain.enabled     = enable;
+    ioen_canDrain.frameBudget = frameBudget;
+    ioen_canDrain.timeBudget  = (SYSTEM_TIME_TYPE)timeBudget;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setCanReader
+ *
+ * DESCRIPTION:
+ *   This function switches the reader of the CAN receive on or off, and empties the receive rings.
+ *   With the reader on, the application runs ioen_runCanReader in a process of its own, with a shorter
+ *   period than the IOM cycle, the cycle then takes the messages from the rings.
+ *   The function must be called before the reader process is started.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canDrain
+ *   Global Data      :  ioen_canRxRing
+ *
+ *   In:  enable      : TRUE = read in the reader process, FALSE = read in the IOM cycle
+ *
+ ******************************************************************/
+void ioen_setCanReader (
+   /* IN     */ const Bool_t                 enable
+)
+{
+    UInt32_t    busIdx;
+
+    for (busIdx = 0; busIdx < IOEN_MAX_CAN_PORT_NUMBER; busIdx++)
+    {
+        ioen_canRxRing[busIdx].head = 0;
+        ioen_canRxRing[busIdx].tail = 0;
+    }
+
+    ioen_canDrain.reader = enable;
 }
 
 
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_getCanBusStatistics
+ *
+ * DESCRIPTION:
+ *   This function returns the receive statistics of a CAN bus, and optionally clears them.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_canDrain
+ *   Global Data      :  ioen_canRxRing
+ *
+ *   In:   busIdx  : Index of the bus, 0 = bus A, 1 = bus B
+ *   In:   clear   : TRUE = clear the statistics after reading
+ *   Out:  stats_p : Statistics of the bus
+ *
+ ******************************************************************/
+void ioen_getCanBusStatistics (
+   /* IN     */ const UInt32_t                       busIdx,
+   /* IN     */ const Bool_t                         clear,
+   /*    OUT */       CanBusStatistics_t     * const stats_p
+)
+{
+    if (busIdx < IOEN_MAX_CAN_PORT_NUMBER)
+    {
+        *stats_p = ioen_canDrain.stats[busIdx];
+
+        /* Counted by the reader, cleared by remembering the count */
+        stats_p->ringFullStops = ioen_canRxRing[busIdx].fullStops - ioen_canRxRing[busIdx].fullStopsRead;
+
+        if (clear == TRUE)
+        {
+            memset (&ioen_canDrain.stats[busIdx], 0, sizeof(CanBusStatistics_t));
+            ioen_canRxRing[busIdx].fullStopsRead += stats_p->ringFullStops;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+    else
+    {
+        memset (stats_p, 0, sizeof(CanBusStatistics_t));
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_getCanMessageArrival
+ *
+ * DESCRIPTION:
+ *   This function returns the arrival time of the last CAN message with a CAN ID taken from the selected bus.
+ *   The arrival time is the time the message was read from the driver, by the reader or by the IOM.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_mrcCanMessageControl
+ *
+ *   In:   canId     : CAN ID of the message
+ *   Out:  arrival_p : Arrival time in ns, 0 before the first message
+ *
+ *   Return : TRUE if the CAN ID is configured
+ *
+ ******************************************************************/
+Bool_t ioen_getCanMessageArrival (
+   /* IN     */ const UInt32_t                       canId,
+   /*    OUT */       SYSTEM_TIME_TYPE       * const arrival_p
+)
+{
+    Bool_t                      found;
+    const CanMessageConfig_t   *msgInfo_p;
+    CANMessageControl_t        *msgCtrl_p;
+
+    ioen_imcLookupMessage (canId, &msgInfo_p, &msgCtrl_p);
+
+    if ((msgInfo_p != NULL_PTR) AND (msgCtrl_p != NULL_PTR))
+    {
+        *arrival_p = msgCtrl_p->lastArrival;
+        found      = TRUE;
+    }
+    else
+    {
+        *arrival_p = 0;
+        found      = FALSE;
+    }
+
+    return found;
+}
@@ -85,6 +85,12 @@ void ioen_initializeIom (
 
     /* Initialise the confirmation structure for each input signal for AFDX and A429 */
     ioen_aaInitSignalConfirmation (ioen_iomConfig_p, ioen_processPeriodicTimeMs);
+
+    /* Compile the execution plan of the AFDX and A429 input processing (needs the input converters) */
+    ioen_epCompilePlan (ioen_iomConfig_p);
+
+    /* Compile the CAN input mappings (needs the parameter buffers and the CAN control of ioen_createPorts) */
+    ioen_imcCompileMappings ();
 }
 
 
@@ -99,6 +105,7 @@ void ioen_initializeIom (
  *   This function creates the CAN  input ports, and stores their APEX port ID's in iomCanRtTbl_p
  *   This function creates the CAN  output ports
  *   This function creates the A429 input ports
+ *   This function initialises the CRC engine
  *
  * INTERFACE:
  *
@@ -119,6 +126,9 @@ void ioen_createPorts (
 {
     ioen_processPeriodicTimeMs  = (Float32_t)appPeriodNanosec / 1000000.0;
     ioen_iomConfig_p            = iom_p;
+
+    /* Build the CRC tables before any AFDX message is read or written */
+    ioen_UtilInitCrc ();
     
     ioen_createRxPortsAfdx (iom_p, ioen_processPeriodicTimeMs);
 
@@ -141,6 +151,9 @@ void ioen_createPorts (
     ioen_createPortsA429 (iom_p, iomA429RtTbl_p,ioen_processPeriodicTimeMs);
     }
     
+    /* Build the message to dataset index for incremental input processing */
+    ioen_incInitIndex (iom_p);
+
     /* Initilises data that must be initialised before the process is in Normal Operation mode */
     /* (takes too long and would produce a deadline missed)                                    */
     ioen_ssInitSourceSelection (ioen_iomConfig_p, ioen_processPeriodicTimeMs);
@@ -38,8 +38,15 @@ Float32_t                    ioen_processPeriodicTimeMs;
 SelectionSetInfo_t           ioen_selectionSetlist [IOEN_MAX_NUMBER_OF_SELECTION_SETS];
 
 IomMessageCtrlData_t         ioen_afdxMsgCtrl[IOEN_MAX_RX_PORT_NUMBER];   /* one entry per message (AFDX) */
+AfdxReadSchedule_t           ioen_afdxReadSchedule;                       /* read schedule of AFDX ports  */
+FreshnessWheel_t             ioen_afdxFreshness;                          /* freshness of AFDX messages   */
+MsgDeadline_t                ioen_afdxDeadline[IOEN_MAX_RX_PORT_NUMBER];  /* one entry per message (AFDX) */
+UInt16_t                     ioen_afdxFreshEvent[IOEN_MAX_RX_PORT_NUMBER];/* one entry per message (AFDX) */
+InputChangeIndex_t           ioen_inputChangeIndex;                       /* message to dataset index     */
+SelectionChangeIndex_t       ioen_selectionChangeIndex;                   /* message to set index         */
+InputExecPlan_t              ioen_inputExecPlan;                          /* input execution plan         */
 
-OutputPortsInfo_t            ioen_outputPortsInfoCan;
+CanTxSchedule_t              ioen_canTxSchedule;
 OutputPortsInfo_t            ioen_outputPortsInfoAfdx;
 
 Bool_t                       ioen_outBoolIsInteger;
@@ -57,16 +64,49 @@ Bool_t                       ioen_outBoolIsInteger;
 IOMCanRoutingPortTbl_t  *ioen_mrcConfigRoutingTable_p;
 IOMA429RoutingPortTbl_t *ioen_429ConfigRoutingTable_p;
 
-/* port ids for the A and B can ports */
-APEX_INTEGER            ioen_apexCanBusIdRxA;
-APEX_INTEGER            ioen_apexCanBusIdRxB;
-APEX_INTEGER            ioen_apexCanBusIdTxA;
-APEX_INTEGER            ioen_apexCanBusIdTxB;
+/* port ids of the can buses, bus A is index 0, bus B is index 1 */
+APEX_INTEGER            ioen_apexCanBusIdRx[IOEN_MAX_CAN_PORT_NUMBER];
+APEX_INTEGER            ioen_apexCanBusIdTx[IOEN_MAX_CAN_PORT_NUMBER];
+UInt32_t                ioen_nofCanRxBuses;
+UInt32_t                ioen_nofCanTxBuses;
 
 
 UInt32_t                ioen_nofCanMessages;
 CANMessageControl_t     ioen_mrcCanMessageControl[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
+UInt16_t                ioen_canIdHash[IOEN_CAN_ID_HASH_SIZE];
+CanDrainCtrl_t          ioen_canDrain;
+CanRxRing_t             ioen_canRxRing[IOEN_MAX_CAN_PORT_NUMBER];   /* Filled by ioen_runCanReader, if the reader is enabled */
+CanMapDesc_t            ioen_canMapPlan[IOEN_CAN_MAX_MAPPINGS];     /* Compiled mappings, built by ioen_imcCompileMappings   */
+UInt32_t                ioen_nofCanMapDesc;
+CanResetRanges_t        ioen_canReset;                              /* Accumulators cleared each cycle, built by ioen_imcInitResetRanges */
+const CanFilterRule_t  *ioen_canFilterRules_p;    /* Set by ioen_setCanFilterRules, NULL = no filtering */
+UInt32_t                ioen_nofCanFilterRules;
+
+/* Mask of the first n data bytes of a 64 bit word, in memory byte order */
+#if TARGET_BYTE_ORDER==LITTLE_ENDIAN
+const UInt64_t          ioen_canLenMask[9] =
+{
+    0x0000000000000000ULL, 0x00000000000000FFULL, 0x000000000000FFFFULL, 0x0000000000FFFFFFULL, 0x00000000FFFFFFFFULL,
+    0x000000FFFFFFFFFFULL, 0x0000FFFFFFFFFFFFULL, 0x00FFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL
+};
+#else
+const UInt64_t          ioen_canLenMask[9] =
+{
+    0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFFFF000000000000ULL, 0xFFFFFF0000000000ULL, 0xFFFFFFFF00000000ULL,
+    0xFFFFFFFFFF000000ULL, 0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFFFULL
+};
+#endif
 A429MessageCtrl_t       ioen_a429MsgControl[IOEN_A429_MAX_PORTS];
+A429ReadCtrl_t          ioen_a429Read;
+A429FwdCtrl_t           ioen_a429Fwd;
+A429RateCtrl_t          ioen_a429Rate;
+A429MessageCtrlData_t   ioen_a429LabelCtrl[IOEN_A429_MAX_CONFIGURED_LABELS];
+FreshnessWheel_t        ioen_a429Freshness;
+MsgDeadline_t           ioen_a429Deadline[IOEN_INC_MAX_A429_MESSAGES];
+UInt16_t                ioen_a429FreshEvent[IOEN_INC_MAX_A429_MESSAGES];
+FreshnessWheel_t        ioen_canFreshness;
+MsgDeadline_t           ioen_canDeadline[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
+UInt16_t                ioen_canFreshEvent[IOEN_MAX_CAN_MESSAGES_CONFIGURED];
 
 
 
@@ -105,6 +145,41 @@ void (*ioen_inputConverters[IOEN_NUMBER_INPUT_MAPPING_TYPES])(const Validity_t,
 };
 
 
+/* Array of batch input mapping functions, converting all signals of one type in one loop (NULL_PTR = no batch function) */
+void (*ioen_inputBatchConverters[IOEN_NUMBER_INPUT_MAPPING_TYPES])(const ExecPlanConvert_t *, const UInt32_t, const Byte_t *, const Byte_t *, Byte_t *) =
+{
+    ioen_icBatch32bUInt,          /* IOEN_INPUT_MAPPING_UINT32               */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_READ64BITS           */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_MULTIPLE_BYTES       */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A664_BOOLEAN32       */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_BITFIELD32           */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_BITFIELD64           */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_READ32BITS_INT2FLOAT */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_READ32BITS_FLOAT2INT */
+    ioen_icBatchA429BNR,          /* IOEN_INPUT_MAPPING_A429BNR              */
+    ioen_icBatchA429UBNR,         /* IOEN_INPUT_MAPPING_A429UBNR             */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429BCD              */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429UBCD             */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429BNR_Float2Int    */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429UBNR_Float2nt    */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429BCD_Float2Int    */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A429UBCD_Float2Int   */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_INT8                 */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_INT16                */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_UINT8                */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_UINT16               */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_INT8_ADD             */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A664STRING           */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_READ32FLOATS         */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_READ64FLOATS         */
+    ioen_icBatch32bInt,           /* IOEN_INPUT_MAPPING_INT32                */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_MESSAGE_UNFRESH      */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_A664_BOOLEAN8        */
+    NULL_PTR,                     /* IOEN_INPUT_MAPPING_BITFIELD8            */
+    NULL_PTR                      /* IOEN_INPUT_MAPPING_READ16BITS_INT2FLOAT */
+};
+
+
 /* Array of operations */
 Validity_t (*ioen_validityChecker[IOEN_NUMBER_CONDITION_TYPES])(const Byte_t *, const ValidityConditionConfig_t *) =
 {
@@ -183,3 +258,10 @@ const UInt32_t crc32LookupTable [IOEN_CRC32_TABLE_SIZE] =
    /* 240 */ 0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
    /* 248 */ 0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4
 };
+
+
+/* Slicing-by-8 CRC tables, built from crc32LookupTable by ioen_UtilInitCrc */
+UInt32_t ioen_crc32SliceTable [IOEN_CRC32_SLICES][IOEN_CRC32_TABLE_SIZE];
+
+/* CRC engine, bytewise until ioen_UtilInitCrc has built the slicing tables */
+UInt32_t (* ioen_crc32Engine)(UInt32_t, const Byte_t *, const UInt32_t) = ioen_UtilCrcBytewise;
@@ -19,6 +19,66 @@
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssCombineValidity
+ *
+ * DESCRIPTION:
+ *   This function combines the validity of one condition into the worst validity of a source
+ *
+ * INTERFACE:
+ *
+ *   In Out:  validityFinal_p     : worst validity found so far
+ *   In:      validityCondition   : validity of the condition
+ *
+ ******************************************************************/
+void ioen_ssCombineValidity (
+    /* IN OUT */       Validity_t                   * const validityFinal_p,
+    /* IN     */ const Validity_t                           validityCondition
+)
+{
+    /* Calculate worst case validity */
+    switch (validityCondition.value)
+    {
+        case IOEN_GLOB_DATA_VALID:
+            if (validityFinal_p->value == IOEN_GLOB_DATA_INIT_VALUE)
+            {
+                /* Not yet initialised, intialise it now */
+                *validityFinal_p = validityCondition;
+            }
+            else if(validityFinal_p->ifValue == IOEN_VALIDITY_NORMALOP && validityCondition.ifValue == IOEN_VALIDITY_TEST)
+            {
+                 *validityFinal_p = validityCondition;
+            }
+            else
+            {
+                /* No action, as designed */
+            }
+            break;
+
+        case IOEN_GLOB_DATA_LOST:
+            /* final validity already set */
+            *validityFinal_p = validityCondition;
+            break;
+
+        default:
+            /* Save error condition */
+            if (validityFinal_p->value != IOEN_GLOB_DATA_LOST)
+            {
+                /* LOST has priority, overwrite with invalid only if lost was not detected */
+                *validityFinal_p = validityCondition;
+            }
+            else
+            {
+                /* No action as deigned */
+            }
+            break;
+
+    }
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_ssCheckSourceValidity
@@ -57,43 +117,7 @@ Validity_t ioen_ssCheckSourceValidity (
         validityCondition = ioen_validityChecker[validityConfig_p->conditionType[valIdx]](inMsgBuffer_p, &validityConfig_p->condition[valIdx]);
 
         /* Calculate worst case validity */
-        switch (validityCondition.value)
-        {
-            case IOEN_GLOB_DATA_VALID:
-                if (validityFinal.value == IOEN_GLOB_DATA_INIT_VALUE)
-                {
-                    /* Not yet initialised, intialise it now */
-                    validityFinal = validityCondition;
-                }
-				else if(validityFinal.ifValue == IOEN_VALIDITY_NORMALOP && validityCondition.ifValue == IOEN_VALIDITY_TEST)
-				{
-				     validityFinal = validityCondition;
-				}
-                else
-                {
-                    /* No action, as designed */
-                }
-                break;
-
-            case IOEN_GLOB_DATA_LOST:
-                /* final validity already set */
-                validityFinal = validityCondition;
-                break;
-
-            default:
-                /* Save error condition */
-                if (validityFinal.value != IOEN_GLOB_DATA_LOST)
-                {
-                    /* LOST has priority, overwrite with invalid only if lost was not detected */
-                    validityFinal = validityCondition;
-                }
-                else
-                {
-                    /* No action as deigned */
-                }
-                break;
-
-        }
+        ioen_ssCombineValidity (&validityFinal, validityCondition);
     }
 
     /* return final result */
@@ -149,6 +173,46 @@ void ioen_ssGetSourceValidity (
 }
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssGetLicValue
+ *
+ * DESCRIPTION:
+ *   This function reads the value of a LIC_PARAMETER from the input parameter buffer
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_inParamBuffer
+ *   Global Data      :  ioen_outBoolIsInteger
+ *
+ *   In     :  iomLicParamConfig_p : pointer to LIC_PARAMETER configuration
+ *
+ *   Return : Value of LIC Parameter
+ *
+ ******************************************************************/
+static UInt32_t ioen_ssGetLicValue (
+    /* IN     */ const LicParamConfig_t     * const iomLicParamConfig_p
+)
+{
+    UInt32_t   data;
+
+    /* Obtain the 32-bits word containing the value */
+    if (     (iomLicParamConfig_p->parType == IOEN_INPUT_MAPPING_A664_BOOLEAN32)
+         AND (ioen_outBoolIsInteger == FALSE)
+       )
+    {
+        /* Get 8 bit BOOLEAN */
+        data = *((Byte_t*)(ioen_inParamBuffer + iomLicParamConfig_p->parOffset));
+    }
+    else
+    {
+        /* Get 32 bit value */
+        data = *((UInt32_t*)(ioen_inParamBuffer + iomLicParamConfig_p->parOffset));
+    }
+
+    return data;
+}
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_ssCheckLicParameter
@@ -199,18 +263,7 @@ Validity_t ioen_ssCheckLicParameter (
 
 
             /* Obtain the 32-bits word containing the value */
-            if (     (iomLicParamConfig_p->parType == IOEN_INPUT_MAPPING_A664_BOOLEAN32)
-                 AND (ioen_outBoolIsInteger == FALSE)
-               )
-            {
-                /* Get 8 bit BOOLEAN */
-                data = *((Byte_t*)(ioen_inParamBuffer + iomLicParamConfig_p->parOffset));
-            }
-            else
-            {
-                /* Get 32 bit value */
-                data = *((UInt32_t*)(ioen_inParamBuffer + iomLicParamConfig_p->parOffset));
-            }
+            data = ioen_ssGetLicValue (iomLicParamConfig_p);
 
             if (    (data == iomLicParamConfig_p->valueExp)
                 AND ((*nextSource_p == IOEN_NO_VALID_SOURCE_FOUND) OR (curSource == selectedSource))
@@ -554,94 +607,223 @@ void ioen_ssPerformLicSelection (
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_ssPerformSourceSelection
+ *   ioen_ssPerformSetSelection
  *
  * DESCRIPTION:
- *      For all selection sets the following is performed:
- *        1. Performs LIC_PARAMETER selection
- *        2. Performs SOURCE_HEALTH_SCORE selection
- *        3. Performs OBJECT_VALID selection
+ *      For one selection set the selection of its criteria is performed:
+ *        1. LIC_PARAMETER selection
+ *        2. SOURCE_HEALTH_SCORE selection
+ *        3. OBJECT_VALID selection
  *
  * INTERFACE:
- *   Global Data      :  ioen_selectionSetlist
  *
  *   In     :  iom_p               : pointer to the IOM configuration
+ *   In     :  curSet              : the current set
+ *   In     :  iomSetConfig_p      : configuration of the current set
  *
  ******************************************************************/
-void ioen_ssPerformSourceSelection (
-    /* IN     */ const IOMConfigHeader_t    * const iom_p
+void ioen_ssPerformSetSelection (
+    /* IN     */ const IOMConfigHeader_t       * const iom_p,
+    /* IN     */ const UInt32_t                        curSet,
+    /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
 )
 {
-    UInt32_t                        curSet;             /* Current Set being processed                                          */
-    const SelectionSetlistConfig_t *iomSetlistConfig_p;
-    const SelectionSetConfig_t     *iomSetConfig_p;
+    if (iomSetConfig_p->criteria == IOEN_SOURCE_LIC_PARAMETER)
+    {
+        /* LIC_PARAMETER selection performed   */
+        ioen_ssPerformLicSelection (iom_p, curSet, iomSetConfig_p);
+    }
+    else if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+    {
+        /* SOURCE_OBJECT_VALID performed */
+        ioen_ssPerformObjectValidSelection (curSet, iomSetConfig_p);
+    }
+    else if (iomSetConfig_p->criteria == IOEN_SOURCE_HEALTH_SCORE)
+    {
+        /* SOURCE_HEALTH_SCORE performed */
+        ioen_ssPerformHealthScoreSelection (curSet, iomSetConfig_p);
+    }
+    else
+    {
+        /* No action as designed */
+        /* IOEN_SOURCE_ONE, No source selection for parameters with only one source */
+    }
+}
 
-    /* In order to have a constant execution time, all sources are evaluated (in order of priority) */
 
-    /* Get pointers to start of source information in the configuration */
-    iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
-    iomSetConfig_p          = (const SelectionSetConfig_t *)          ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssMarkSet
+ *
+ * DESCRIPTION:
+ *   This function marks a selection set to be evaluated in the next cycle (change driven selection).
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In     :  curSet              : the set to mark
+ *
+ ******************************************************************/
+static void ioen_ssMarkSet (
+    /* IN     */ const UInt32_t                        curSet
+)
+{
+    SelectionChangeIndex_t *index_p;
 
-    /* Loop for all sets */
-    for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
+    index_p = &ioen_selectionChangeIndex;
+
+    if ((index_p->setFlags[curSet] BIT_AND IOEN_SS_SET_DIRTY) == 0)
     {
-        if (iomSetConfig_p->criteria == IOEN_SOURCE_LIC_PARAMETER)
-        {
-            /* LIC_PARAMETER selection performed   */
-            ioen_ssPerformLicSelection (iom_p, curSet, iomSetConfig_p);
-        }
-        else if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+        index_p->setFlags[curSet]       |= IOEN_SS_SET_DIRTY;
+        index_p->dirty[index_p->nofDirty] = (UInt16_t)curSet;
+        index_p->nofDirty++;
+    }
+    else
+    {
+        /* No action as designed, already marked */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssMarkAllSets
+ *
+ * DESCRIPTION:
+ *   This function marks all selection sets with a selection to be evaluated in the next cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ ******************************************************************/
+static void ioen_ssMarkAllSets (
+    /*        */       void
+)
+{
+    UInt32_t                curSet;
+    SelectionChangeIndex_t *index_p;
+
+    index_p = &ioen_selectionChangeIndex;
+
+    if (index_p->valid == TRUE)
+    {
+        for (curSet = 0; curSet < index_p->nofSets; curSet++)
         {
-            /* SOURCE_OBJECT_VALID performed */
-            ioen_ssPerformObjectValidSelection (curSet, iomSetConfig_p);
+            if (index_p->setConfig_p[curSet]->criteria != IOEN_SOURCE_ONE)
+            {
+                ioen_ssMarkSet (curSet);
+            }
+            else
+            {
+                /* No action as designed                    */
+                /* No source selection for a single source  */
+            }
         }
-        else if (iomSetConfig_p->criteria == IOEN_SOURCE_HEALTH_SCORE)
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssAddReference
+ *
+ * DESCRIPTION:
+ *   This function adds one message reference of an OBJECT_VALID selection set to the index.
+ *   In the count pass only the number of references per message is counted,
+ *   in the fill pass the set is stored (once per message).
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In:  transport   : transport of the referenced message
+ *   In:  msgIdx      : index of the referenced message
+ *   In:  curSet      : index of the selection set
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
+ *
+ ******************************************************************/
+static void ioen_ssAddReference (
+    /* IN     */ const UInt32_t                    transport,
+    /* IN     */ const UInt32_t                    msgIdx,
+    /* IN     */ const UInt32_t                    curSet,
+    /* IN     */ const Bool_t                      fillPass
+)
+{
+    UInt32_t                key;
+    UInt32_t                entry;
+    SelectionChangeIndex_t *index_p;
+
+    index_p = &ioen_selectionChangeIndex;
+    key     = ioen_incMessageKey (transport, msgIdx);
+
+    if (key >= IOEN_INC_MAX_MESSAGES)
+    {
+        /* Message can not be indexed, evaluate the set every cycle */
+        index_p->setFlags[curSet] |= IOEN_SS_SET_ALWAYS;
+    }
+    else if (fillPass == FALSE)
+    {
+        /* Count pass, reserve space for this reference */
+        index_p->msgCount[key]++;
+    }
+    else
+    {
+        entry = index_p->msgFirst[key] + index_p->msgCount[key];
+
+        /* Sets are added in increasing order, so a repeated reference is always the last entry */
+        if (    (index_p->msgCount[key] == 0)
+            OR  (index_p->set[entry - 1] != curSet)
+           )
         {
-            /* SOURCE_HEALTH_SCORE performed */
-            ioen_ssPerformHealthScoreSelection (curSet, iomSetConfig_p);
+            index_p->set[entry] = (UInt16_t)curSet;
+            index_p->msgCount[key]++;
         }
         else
         {
-            /* No action as designed */
-            /* IOEN_SOURCE_ONE, No source selection for parameters with only one source */
+            /* No action as designed                          */
+            /* Set already registered for this message        */
         }
-
-        /* Increment pointer to next set */
-        iomSetConfig_p = (const SelectionSetConfig_t *) ((const void *)(iomSetConfig_p) + iomSetConfig_p->setConfigSize);
-
     }
-
 }
 
 
 
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_ssCalcSourceSelectionObjects
+ *   ioen_ssAddAllSets
  *
  * DESCRIPTION:
- *      For all selection sets the following is performed:
- *        1. Performs OBJECT_VALID validity calculation
+ *   This function adds all selection sets to the change index:
+ *     - OBJECT_VALID        : the messages of the validity conditions of each source
+ *     - LIC_PARAMETER       : checked every cycle for a change of its LIC parameters
+ *     - SOURCE_HEALTH_SCORE : evaluated every cycle, the health scores are counted per cycle
  *
  * INTERFACE:
- *   Global Data      :  ioen_selectionSetlist
- *   Global Data      :  ioen_inMsgBuffer
+ *   Global Data      :  ioen_selectionChangeIndex
  *
- *   In     :  iom_p               : pointer to the IOM configuration
+ *   In:  iom_p       : pointer to IOM Configuration
+ *   In:  fillPass    : FALSE = count pass, TRUE = fill pass
  *
  ******************************************************************/
-void ioen_ssCalcSourceSelectionObjects (
-    /* IN     */ const IOMConfigHeader_t    * const iom_p
+static void ioen_ssAddAllSets (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p,
+    /* IN     */ const Bool_t                       fillPass
 )
 {
     UInt32_t                        curSet;
     UInt32_t                        curSource;
-    SelectionSetInfo_t             *setData_p;
+    UInt32_t                        condIdx;
     const SelectionSetlistConfig_t *iomSetlistConfig_p;
     const SelectionSetConfig_t     *iomSetConfig_p;
     const ValidityConfig_t         *validityLogic_p;
+    SelectionChangeIndex_t         *index_p;
 
-    /* In order to have a constant execution time, all sources are evaluated (in order of priority) */
+    index_p = &ioen_selectionChangeIndex;
 
     /* Get pointers to start of source information in the configuration */
     iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
@@ -650,89 +832,670 @@ void ioen_ssCalcSourceSelectionObjects (
     /* Loop for all sets */
     for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
     {
+        index_p->setConfig_p[curSet] = iomSetConfig_p;
+
         if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
         {
-            /* Calculate extra set validity of this selection sets criteria */
-
-            setData_p = &ioen_selectionSetlist[curSet]; /* shortcut to set dynamic data */
-
             /* first logic starts after Selection set header */
             validityLogic_p = (const ValidityConfig_t *)  ((const void *)(iom_p) + iomSetConfig_p->sourceOffset);
 
-            /* Loop for all sources in a set */
+            /* Messages checked by the validity conditions of each source */
             for (curSource=0; curSource < iomSetConfig_p->nofSources; curSource++)
             {
-                /* Check all validities for the Object */
-                setData_p->ctrl[curSource].validity.current = ioen_ssCheckSourceValidity(ioen_inMsgBuffer, &validityLogic_p[curSource]);
-                setData_p->lock[curSource].validity.current = setData_p->ctrl[curSource].validity.current;
+                for (condIdx = 0; condIdx < validityLogic_p[curSource].numConditions; condIdx++)
+                {
+                    ioen_ssAddReference (validityLogic_p[curSource].condition[condIdx].transport,
+                                         validityLogic_p[curSource].condition[condIdx].msgIdx,
+                                         curSet,
+                                         fillPass);
+                }
             }
+        }
+        else if (iomSetConfig_p->criteria == IOEN_SOURCE_LIC_PARAMETER)
+        {
+            index_p->setFlags[curSet] |= IOEN_SS_SET_LIC;
+        }
+        else if (iomSetConfig_p->criteria == IOEN_SOURCE_HEALTH_SCORE)
+        {
+            index_p->setFlags[curSet] |= IOEN_SS_SET_ALWAYS;
+        }
+        else
+        {
+            /* No action as designed                    */
+            /* No source selection for a single source  */
+        }
 
-            /* Confirm current validities for all sources in this selection set */
-            ioen_ConfirmObjectValidity (iomSetConfig_p->nofSources, setData_p->ctrl);
-
-            /* Confirm current lock intervals for all sources in this selection set */
-            ioen_ConfirmObjectValidity (iomSetConfig_p->nofSources, setData_p->lock);
-
+        if (    (fillPass == TRUE)
+            AND ((index_p->setFlags[curSet] BIT_AND (IOEN_SS_SET_ALWAYS BIT_OR IOEN_SS_SET_LIC)) != 0)
+           )
+        {
+            /* Checked every cycle */
+            index_p->watched[index_p->nofWatched] = (UInt16_t)curSet;
+            index_p->nofWatched++;
         }
         else
         {
-            /* No action as designed                                     */
-            /* There are only extra validity parameters for OBJECT_VALID */
+            /* No action as designed */
         }
 
         /* Increment pointer to next set */
         iomSetConfig_p = (const SelectionSetConfig_t *) ((const void *)(iomSetConfig_p) + iomSetConfig_p->setConfigSize);
-
     }
-
 }
 
 
 
-
 /******************************************************************
  * FUNCTION NAME:
- *   ioen_ssInitSourceSelection
+ *   ioen_ssInitChangeIndex
  *
  * DESCRIPTION:
- *      Initialises global data for all selection sets
+ *   This function builds the index from input messages to the OBJECT_VALID selection sets,
+ *   and the list of sets checked every cycle.
+ *   If the configuration does not fit in the index, all sets stay evaluated every cycle.
  *
  * INTERFACE:
- *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_selectionChangeIndex
  *
  *   In:  iom_p       : pointer to IOM Configuration
- *   In:  appPeriodMs : Periodic time of process in millisecs
  *
  ******************************************************************/
-void ioen_ssInitSourceSelection (
-    /* IN     */ const IOMConfigHeader_t   * const iom_p,
-    /* IN     */ const Float32_t                   appPeriodMs
+static void ioen_ssInitChangeIndex (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
 )
 {
-    UInt32_t                        curSet;
+    UInt32_t                        key;
+    UInt32_t                        nofEntries;
+    Bool_t                          enabled;
+    UInt32_t                        fullSweepInterval;
     const SelectionSetlistConfig_t *iomSetlistConfig_p;
-    const SelectionSetConfig_t     *iomSetConfig_p;
-    const ValidityConfig_t         *validityLogic_p;
+    SelectionChangeIndex_t         *index_p;
 
-    /* Clear dynamic data and Set default source selections to first entry (0=highest priority) */
-    memset ((void *) &ioen_selectionSetlist, 0x00, sizeof(ioen_selectionSetlist));
+    index_p = &ioen_selectionChangeIndex;
 
-    /* Initialise confirmation times for all selection sets, that are OBJECT_VALID */
-    
-    /* Get pointers to start of source information in the configuration */
-    iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
-    iomSetConfig_p          = (const SelectionSetConfig_t *)          ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+    /* Keep the mode requested by the application */
+    enabled           = index_p->enabled;
+    fullSweepInterval = index_p->fullSweepInterval;
 
-    /* Loop for all sets */
-    for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
+    memset ((void *) index_p, 0x00, sizeof(SelectionChangeIndex_t));
+
+    index_p->enabled           = enabled;
+    index_p->fullSweepInterval = fullSweepInterval;
+
+    iomSetlistConfig_p = (const SelectionSetlistConfig_t *) ((const void *)(iom_p) + iom_p->selectionSetStart);
+    index_p->nofSets   = iomSetlistConfig_p->nofSets;
+
+    if (index_p->nofSets <= IOEN_MAX_NUMBER_OF_SELECTION_SETS)
     {
-        if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+        /* Count the references per message */
+        ioen_ssAddAllSets (iom_p, FALSE);
+
+        /* Reserve the entries of each message */
+        nofEntries = 0;
+        for (key = 0; key < IOEN_INC_MAX_MESSAGES; key++)
         {
-            /* Initialise the validity confirmation structure                */
-            /* NB: There are only extra validity parameters for OBJECT_VALID */
+            index_p->msgFirst[key] = nofEntries;
+            nofEntries            += index_p->msgCount[key];
+            index_p->msgCount[key] = 0;
+        }
 
-            /* first logic starts after Selection set header */
-            validityLogic_p = (const ValidityConfig_t *)  ((const void *)(iom_p) + iomSetConfig_p->sourceOffset);
+        if (nofEntries <= IOEN_SS_MAX_INDEX_ENTRIES)
+        {
+            /* Store the sets per message */
+            ioen_ssAddAllSets (iom_p, TRUE);
+
+            index_p->valid = TRUE;
+        }
+        else
+        {
+            /* No action as designed                        */
+            /* Too many references, index stays invalid     */
+        }
+    }
+    else
+    {
+        /* No action as designed                        */
+        /* Too many sets, index stays invalid           */
+    }
+
+    /* Evaluate all sets in the first cycle */
+    ioen_ssMarkAllSets ();
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssMarkMessage
+ *
+ * DESCRIPTION:
+ *   This function marks the OBJECT_VALID selection sets checking a message to be evaluated.
+ *   It is called when the message was received or its freshness changed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In:  key         : index of the message, see ioen_incMessageKey
+ *
+ ******************************************************************/
+void ioen_ssMarkMessage (
+    /* IN     */ const UInt32_t                    key
+)
+{
+    UInt32_t                entry;
+    UInt32_t                lastEntry;
+    SelectionChangeIndex_t *index_p;
+
+    index_p = &ioen_selectionChangeIndex;
+
+    if (    (index_p->valid == TRUE)
+        AND (key < IOEN_INC_MAX_MESSAGES)
+       )
+    {
+        lastEntry = index_p->msgFirst[key] + index_p->msgCount[key];
+
+        for (entry = index_p->msgFirst[key]; entry < lastEntry; entry++)
+        {
+            ioen_ssMarkSet (index_p->set[entry]);
+        }
+    }
+    else
+    {
+        /* No action as designed */
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssLicChanged
+ *
+ * DESCRIPTION:
+ *   This function checks if a LIC_PARAMETER of a selection set changed since its last evaluation.
+ *   Without a change, the LIC selection gives the same source as the last time.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_inParamBuffer
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *   In     :  curSet              : the current set
+ *   In     :  iomSetConfig_p      : configuration of the current set
+ *
+ *   Return : TRUE if a value or validity of a LIC parameter changed
+ *
+ ******************************************************************/
+static Bool_t ioen_ssLicChanged (
+    /* IN     */ const IOMConfigHeader_t       * const iom_p,
+    /* IN     */ const UInt32_t                        curSet,
+    /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
+)
+{
+    Bool_t                          changed;
+    UInt32_t                        curSource;
+    UInt32_t                        data;
+    UInt32_t                        validity;
+    SelectionSetInfo_t             *setData_p;
+    const LicParamConfig_t         *iomLicParamConfig_p;
+
+    changed             = FALSE;
+    setData_p           = &ioen_selectionSetlist[curSet]; /* shortcut to set dynamic data */
+    iomLicParamConfig_p = (const LicParamConfig_t *)  ((const void *)(iom_p) + iomSetConfig_p->sourceOffset);
+
+    for (curSource=0; curSource < iomSetConfig_p->nofSources; curSource++)
+    {
+        data     = ioen_ssGetLicValue (&iomLicParamConfig_p[curSource]);
+        validity = *((UInt32_t *)(ioen_inParamBuffer + iomLicParamConfig_p[curSource].valOffset));
+
+        if (    (data     != setData_p->licValue[curSource])
+             OR (validity != setData_p->licValidity[curSource])
+           )
+        {
+            setData_p->licValue[curSource]    = data;
+            setData_p->licValidity[curSource] = validity;
+            changed                           = TRUE;
+        }
+        else
+        {
+            /* No action as designed */
+        }
+    }
+
+    return changed;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssCollectSets
+ *
+ * DESCRIPTION:
+ *   This function collects the selection sets to be evaluated this cycle (change driven selection):
+ *     - the sets marked by a changed message or a running confirmation
+ *     - the sets evaluated every cycle, and the LIC_PARAMETER sets with a changed LIC parameter
+ *     - all sets, every fullSweepInterval cycles
+ *   It is called once per cycle, after the input datasets are processed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *   Global Data      :  ioen_iomConfig_p
+ *
+ *   Return : TRUE if only the collected sets are evaluated this cycle, FALSE for all sets
+ *
+ ******************************************************************/
+Bool_t ioen_ssCollectSets (
+    /*        */       void
+)
+{
+    UInt32_t                idx;
+    UInt32_t                curSet;
+    SelectionChangeIndex_t *index_p;
+
+    index_p         = &ioen_selectionChangeIndex;
+    index_p->listed = FALSE;
+
+    if (    (index_p->enabled == TRUE)
+        AND (index_p->valid   == TRUE)
+       )
+    {
+        /* Safety net, evaluate all sets regularly */
+        index_p->sweepCycle++;
+
+        if (    (index_p->fullSweepInterval != 0)
+            AND (index_p->sweepCycle >= index_p->fullSweepInterval)
+           )
+        {
+            index_p->sweepCycle = 0;
+            ioen_ssMarkAllSets ();
+        }
+        else
+        {
+            /* No action as designed */
+        }
+
+        /* Sets checked every cycle */
+        for (idx = 0; idx < index_p->nofWatched; idx++)
+        {
+            curSet = index_p->watched[idx];
+
+            if ((index_p->setFlags[curSet] BIT_AND IOEN_SS_SET_ALWAYS) != 0)
+            {
+                ioen_ssMarkSet (curSet);
+            }
+            else if (ioen_ssLicChanged (ioen_iomConfig_p, curSet, index_p->setConfig_p[curSet]) == TRUE)
+            {
+                ioen_ssMarkSet (curSet);
+            }
+            else
+            {
+                /* No action as designed                  */
+                /* LIC parameters unchanged, same result  */
+            }
+        }
+
+        /* Evaluate the marked sets, marks from now on are for the next cycle */
+        for (idx = 0; idx < index_p->nofDirty; idx++)
+        {
+            curSet                     = index_p->dirty[idx];
+            index_p->eval[idx]         = (UInt16_t)curSet;
+            index_p->setFlags[curSet]  = index_p->setFlags[curSet] BIT_AND (Byte_t)(BIT_NOT IOEN_SS_SET_DIRTY);
+        }
+
+        index_p->nofEval  = index_p->nofDirty;
+        index_p->nofDirty = 0;
+        index_p->listed   = TRUE;
+    }
+    else
+    {
+        /* No action as designed         */
+        /* All sets evaluated            */
+    }
+
+    return index_p->listed;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssCalcListedSets
+ *
+ * DESCRIPTION:
+ *   This function calculates the OBJECT_VALID set validities of the sets collected by ioen_ssCollectSets.
+ *   A set whose confirmation is still running is evaluated again in the next cycle.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *   Global Data      :  ioen_selectionSetlist
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *
+ ******************************************************************/
+void ioen_ssCalcListedSets (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                        idx;
+    UInt32_t                        curSet;
+    UInt32_t                        curSource;
+    const SelectionSetConfig_t     *iomSetConfig_p;
+    SelectionSetInfo_t             *setData_p;
+    SelectionChangeIndex_t         *index_p;
+
+    index_p = &ioen_selectionChangeIndex;
+
+    for (idx = 0; idx < index_p->nofEval; idx++)
+    {
+        curSet         = index_p->eval[idx];
+        iomSetConfig_p = index_p->setConfig_p[curSet];
+
+        if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+        {
+            /* Calculate extra set validity of this selection sets criteria */
+            ioen_ssCalcSetObjects (iom_p, curSet, iomSetConfig_p);
+
+            /* Without a message change the result only changes while a confirmation is running */
+            setData_p = &ioen_selectionSetlist[curSet];
+
+            for (curSource=0; curSource < iomSetConfig_p->nofSources; curSource++)
+            {
+                if (    (setData_p->ctrl[curSource].cycle != 0)
+                     OR (setData_p->lock[curSource].cycle != 0)
+                   )
+                {
+                    ioen_ssMarkSet (curSet);
+                }
+                else
+                {
+                    /* No action as designed */
+                }
+            }
+        }
+        else
+        {
+            /* No action as designed                                     */
+            /* There are only extra validity parameters for OBJECT_VALID */
+        }
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssPerformListedSets
+ *
+ * DESCRIPTION:
+ *   This function performs the source selection of the sets collected by ioen_ssCollectSets.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *
+ ******************************************************************/
+void ioen_ssPerformListedSets (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                        idx;
+    UInt32_t                        curSet;
+    SelectionChangeIndex_t         *index_p;
+
+    index_p = &ioen_selectionChangeIndex;
+
+    for (idx = 0; idx < index_p->nofEval; idx++)
+    {
+        curSet = index_p->eval[idx];
+
+        ioen_ssPerformSetSelection (iom_p, curSet, index_p->setConfig_p[curSet]);
+    }
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_setChangeDrivenSelection
+ *
+ * DESCRIPTION:
+ *   This function switches change driven evaluation of the selection sets on or off.
+ *   When switched on, a selection set is only evaluated when a message of its validity conditions changed,
+ *   its LIC parameter changed, or its confirmation is still running. SOURCE_HEALTH_SCORE sets are
+ *   evaluated every cycle. All sets are evaluated once in the next cycle, and every fullSweepInterval cycles.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In:  enable            : TRUE = only evaluate changed sets, FALSE = evaluate all sets every cycle
+ *   In:  fullSweepInterval : number of cycles between two evaluations of all sets, 0 = no full evaluation
+ *
+ ******************************************************************/
+void ioen_setChangeDrivenSelection (
+    /* IN     */ const Bool_t                       enable,
+    /* IN     */ const UInt32_t                     fullSweepInterval
+)
+{
+    ioen_selectionChangeIndex.enabled           = enable;
+    ioen_selectionChangeIndex.fullSweepInterval = fullSweepInterval;
+    ioen_selectionChangeIndex.sweepCycle        = 0;
+
+    ioen_ssMarkAllSets ();
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssPerformSourceSelection
+ *
+ * DESCRIPTION:
+ *      For all selection sets the following is performed:
+ *        1. Performs LIC_PARAMETER selection
+ *        2. Performs SOURCE_HEALTH_SCORE selection
+ *        3. Performs OBJECT_VALID selection
+ *      With change driven selection only the sets collected by ioen_ssCollectSets are processed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *
+ ******************************************************************/
+void ioen_ssPerformSourceSelection (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                        curSet;             /* Current Set being processed                                          */
+    const SelectionSetlistConfig_t *iomSetlistConfig_p;
+    const SelectionSetConfig_t     *iomSetConfig_p;
+
+    /* In order to have a constant execution time, all sources are evaluated (in order of priority) */
+
+    /* Get pointers to start of source information in the configuration */
+    iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
+    iomSetConfig_p          = (const SelectionSetConfig_t *)          ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+
+    if (ioen_selectionChangeIndex.listed == TRUE)
+    {
+        /* Change driven, only the sets collected by ioen_ssCalcSourceSelectionObjects */
+        ioen_ssPerformListedSets (iom_p);
+    }
+    else
+    {
+        /* Loop for all sets */
+        for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
+        {
+            ioen_ssPerformSetSelection (iom_p, curSet, iomSetConfig_p);
+
+            /* Increment pointer to next set */
+            iomSetConfig_p = (const SelectionSetConfig_t *) ((const void *)(iomSetConfig_p) + iomSetConfig_p->setConfigSize);
+
+        }
+    }
+
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssCalcSetObjects
+ *
+ * DESCRIPTION:
+ *      For one OBJECT_VALID selection set the set validity of each source is calculated and confirmed
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_inMsgBuffer
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *   In     :  curSet              : the current set
+ *   In     :  iomSetConfig_p      : configuration of the current set
+ *
+ ******************************************************************/
+void ioen_ssCalcSetObjects (
+    /* IN     */ const IOMConfigHeader_t       * const iom_p,
+    /* IN     */ const UInt32_t                        curSet,
+    /* IN     */ const SelectionSetConfig_t    * const iomSetConfig_p
+)
+{
+    UInt32_t                        curSource;
+    SelectionSetInfo_t             *setData_p;
+    const ValidityConfig_t         *validityLogic_p;
+
+    setData_p = &ioen_selectionSetlist[curSet]; /* shortcut to set dynamic data */
+
+    /* first logic starts after Selection set header */
+    validityLogic_p = (const ValidityConfig_t *)  ((const void *)(iom_p) + iomSetConfig_p->sourceOffset);
+
+    /* Loop for all sources in a set */
+    for (curSource=0; curSource < iomSetConfig_p->nofSources; curSource++)
+    {
+        /* Check all validities for the Object */
+        setData_p->ctrl[curSource].validity.current = ioen_ssCheckSourceValidity(ioen_inMsgBuffer, &validityLogic_p[curSource]);
+        setData_p->lock[curSource].validity.current = setData_p->ctrl[curSource].validity.current;
+    }
+
+    /* Confirm current validities for all sources in this selection set */
+    ioen_ConfirmObjectValidity (iomSetConfig_p->nofSources, setData_p->ctrl);
+
+    /* Confirm current lock intervals for all sources in this selection set */
+    ioen_ConfirmObjectValidity (iomSetConfig_p->nofSources, setData_p->lock);
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssCalcSourceSelectionObjects
+ *
+ * DESCRIPTION:
+ *      For all selection sets the following is performed:
+ *        1. Performs OBJECT_VALID validity calculation
+ *      With change driven selection only the sets collected by ioen_ssCollectSets are processed.
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_selectionChangeIndex
+ *   Global Data      :  ioen_inMsgBuffer
+ *
+ *   In     :  iom_p               : pointer to the IOM configuration
+ *
+ ******************************************************************/
+void ioen_ssCalcSourceSelectionObjects (
+    /* IN     */ const IOMConfigHeader_t    * const iom_p
+)
+{
+    UInt32_t                        curSet;
+    const SelectionSetlistConfig_t *iomSetlistConfig_p;
+    const SelectionSetConfig_t     *iomSetConfig_p;
+
+    /* In order to have a constant execution time, all sources are evaluated (in order of priority) */
+
+    /* Get pointers to start of source information in the configuration */
+    iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
+    iomSetConfig_p          = (const SelectionSetConfig_t *)          ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+
+    if (ioen_ssCollectSets () == TRUE)
+    {
+        /* Change driven, only the sets that changed or are still confirming */
+        ioen_ssCalcListedSets (iom_p);
+    }
+    else
+    {
+        /* Loop for all sets */
+        for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
+        {
+            if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+            {
+                /* Calculate extra set validity of this selection sets criteria */
+                ioen_ssCalcSetObjects (iom_p, curSet, iomSetConfig_p);
+            }
+            else
+            {
+                /* No action as designed                                     */
+                /* There are only extra validity parameters for OBJECT_VALID */
+            }
+
+            /* Increment pointer to next set */
+            iomSetConfig_p = (const SelectionSetConfig_t *) ((const void *)(iomSetConfig_p) + iomSetConfig_p->setConfigSize);
+
+        }
+    }
+
+}
+
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_ssInitSourceSelection
+ *
+ * DESCRIPTION:
+ *      Initialises global data for all selection sets
+ *
+ * INTERFACE:
+ *   Global Data      :  ioen_selectionSetlist
+ *   Global Data      :  ioen_selectionChangeIndex
+ *
+ *   In:  iom_p       : pointer to IOM Configuration
+ *   In:  appPeriodMs : Periodic time of process in millisecs
+ *
+ ******************************************************************/
+void ioen_ssInitSourceSelection (
+    /* IN     */ const IOMConfigHeader_t   * const iom_p,
+    /* IN     */ const Float32_t                   appPeriodMs
+)
+{
+    UInt32_t                        curSet;
+    const SelectionSetlistConfig_t *iomSetlistConfig_p;
+    const SelectionSetConfig_t     *iomSetConfig_p;
+    const ValidityConfig_t         *validityLogic_p;
+
+    /* Clear dynamic data and Set default source selections to first entry (0=highest priority) */
+    memset ((void *) &ioen_selectionSetlist, 0x00, sizeof(ioen_selectionSetlist));
+
+    /* Initialise confirmation times for all selection sets, that are OBJECT_VALID */
+    
+    /* Get pointers to start of source information in the configuration */
+    iomSetlistConfig_p      = (const SelectionSetlistConfig_t *)      ((const void *)(iom_p) + iom_p->selectionSetStart);
+    iomSetConfig_p          = (const SelectionSetConfig_t *)          ((const void *)(iom_p) + iomSetlistConfig_p->setListOffset);
+
+    /* Loop for all sets */
+    for (curSet=0;  curSet < iomSetlistConfig_p->nofSets; curSet++)
+    {
+        if (iomSetConfig_p->criteria == IOEN_OBJECT_VALID)
+        {
+            /* Initialise the validity confirmation structure                */
+            /* NB: There are only extra validity parameters for OBJECT_VALID */
+
+            /* first logic starts after Selection set header */
+            validityLogic_p = (const ValidityConfig_t *)  ((const void *)(iom_p) + iomSetConfig_p->sourceOffset);
 
             ioen_ConfirmInitParamValidity (iom_p,
                                            appPeriodMs,
@@ -765,6 +1528,7 @@ void ioen_ssInitSourceSelection (
 
     }
 
-
+    /* Build the message to selection set index for change driven selection */
+    ioen_ssInitChangeIndex (iom_p);
 }
 
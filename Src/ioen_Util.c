@@ -16,19 +16,161 @@
 
 
 
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_UtilInitCrc
+ *
+ * DESCRIPTION:
+ *   This function builds the slicing-by-8 CRC tables from crc32LookupTable and selects the CRC engine.
+ *   Slice n holds the CRC of a byte followed by n zero bytes, so slice 0 is crc32LookupTable itself.
+ *   Until this function is called the bytewise engine is used.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  crc32LookupTable
+ *   Global Data      :  ioen_crc32SliceTable
+ *   Global Data      :  ioen_crc32Engine
+ *
+ ******************************************************************/
+void ioen_UtilInitCrc (
+   /*        */       void
+)
+{
+    UInt32_t slice;
+    UInt32_t i;
+    UInt32_t crc32;
+
+    for (i = 0; i < IOEN_CRC32_TABLE_SIZE; i++)
+    {
+        crc32 = crc32LookupTable[i];
+        ioen_crc32SliceTable[0][i] = crc32;
+
+        for (slice = 1; slice < IOEN_CRC32_SLICES; slice++)
+        {
+            /* Append one zero byte to the previous slice */
+            crc32 = (crc32 BIT_LSHIFT 8) BIT_XOR crc32LookupTable[crc32 BIT_RSHIFT 24];
+            ioen_crc32SliceTable[slice][i] = crc32;
+        }
+    }
+
+    ioen_crc32Engine = ioen_UtilCrcSlice8;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_UtilCrcBytewise
+ *
+ * DESCRIPTION:
+ *   This function updates an ARINC 32 bit CRC one byte at a time using crc32LookupTable.
+ *   Neither the seed value nor the finish XOR are applied.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  crc32LookupTable
+ *
+ *   In:  crc32        : CRC value so far
+ *   In:  data_p       : pointer to input array to calculate the CRC on
+ *   In:  nofBytes     : number of bytes to process
+ *
+ *   Return: updated CRC value
+ *
+ ******************************************************************/
+UInt32_t ioen_UtilCrcBytewise (
+   /* IN     */       UInt32_t                   crc32,
+   /* IN     */ const Byte_t             * const data_p,
+   /* IN     */ const UInt32_t                   nofBytes
+)
+{
+    UInt32_t i;
+    UInt32_t k;
+
+    for (i=0; i<nofBytes; i++)
+    {
+        k     = ((crc32 BIT_RSHIFT 24) BIT_XOR (UInt32_t)(data_p[i])) BIT_AND 0xFF;
+        crc32 = (crc32 BIT_LSHIFT 8) BIT_XOR crc32LookupTable[k];
+    }
+
+    return crc32;
+}
+
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_UtilCrcSlice8
+ *
+ * DESCRIPTION:
+ *   This function updates an ARINC 32 bit CRC eight bytes at a time (slicing-by-8).
+ *   The eight table lookups of one step are independent of each other, instead of
+ *   eight dependent lookups with the bytewise engine. The result is identical.
+ *   Bytes are loaded one by one, so the function does not depend on the target byte order or alignment.
+ *   Neither the seed value nor the finish XOR are applied.
+ *
+ * INTERFACE:
+ *
+ *   Global Data      :  ioen_crc32SliceTable
+ *
+ *   In:  crc32        : CRC value so far
+ *   In:  data_p       : pointer to input array to calculate the CRC on
+ *   In:  nofBytes     : number of bytes to process
+ *
+ *   Return: updated CRC value
+ *
+ ******************************************************************/
+UInt32_t ioen_UtilCrcSlice8 (
+   /* IN     */       UInt32_t                   crc32,
+   /* IN     */ const Byte_t             * const data_p,
+   /* IN     */ const UInt32_t                   nofBytes
+)
+{
+    const Byte_t *byte_p;
+    UInt32_t      nofBlocks;
+    UInt32_t      i;
+
+    byte_p    = data_p;
+    nofBlocks = nofBytes / IOEN_CRC32_SLICES;
+
+    for (i = 0; i < nofBlocks; i++)
+    {
+        /* The first four bytes are merged into the CRC (MSB first) */
+        crc32 = crc32 BIT_XOR (  ((UInt32_t)byte_p[0] BIT_LSHIFT 24)
+                               BIT_OR ((UInt32_t)byte_p[1] BIT_LSHIFT 16)
+                               BIT_OR ((UInt32_t)byte_p[2] BIT_LSHIFT 8)
+                               BIT_OR  (UInt32_t)byte_p[3]);
+
+        crc32 = ioen_crc32SliceTable[7][ crc32 BIT_RSHIFT 24]
+                BIT_XOR ioen_crc32SliceTable[6][(crc32 BIT_RSHIFT 16) BIT_AND 0xFF]
+                BIT_XOR ioen_crc32SliceTable[5][(crc32 BIT_RSHIFT 8)  BIT_AND 0xFF]
+                BIT_XOR ioen_crc32SliceTable[4][ crc32                BIT_AND 0xFF]
+                BIT_XOR ioen_crc32SliceTable[3][byte_p[4]]
+                BIT_XOR ioen_crc32SliceTable[2][byte_p[5]]
+                BIT_XOR ioen_crc32SliceTable[1][byte_p[6]]
+                BIT_XOR ioen_crc32SliceTable[0][byte_p[7]];
+
+        byte_p += IOEN_CRC32_SLICES;
+    }
+
+    /* Remaining bytes */
+    return ioen_UtilCrcBytewise (crc32, byte_p, nofBytes - (nofBlocks * IOEN_CRC32_SLICES));
+}
+
+
+
 /******************************************************************
  * FUNCTION NAME:
  *   ioen_UtilCheckCrc
  *
  * DESCRIPTION:
  *   This function calculates an ARINC 32 bit CRC for the given input data.
- *   A lookup table is used to improve performance.
+ *   The CRC engine selected by ioen_UtilInitCrc is used (see ioen_UtilCrcSlice8).
  *   The Polynomial used for (ARINC 653) is
  *      0x04C11DB7, => x32 + x26 + x23 + x22 + x16 + x12 + x11 + x10 + x8 + x7 + x5 + x4 + x2 + x + 1
  *
  * INTERFACE:
  *
- *   Global Data      :  crc32LookupTable
+ *   Global Data      :  ioen_crc32Engine
  *
  *   In:  data_p       : pointer to input array to calculate the CRC on
  *   In:  msginfo_p    : Pointer to information where the CRC is stored
@@ -40,11 +182,8 @@ Bool_t ioen_UtilCheckCrc (
 )
 {
     Bool_t   crcOk;
-    UInt32_t nofBytes;
     UInt32_t crc32;
     UInt32_t crcExpected;
-    UInt32_t i;
-    UInt32_t k;
 
     if (msginfo_p->crcOffset != 0)
     {
@@ -53,14 +192,7 @@ Bool_t ioen_UtilCheckCrc (
         {
             /* Normal operation, calculate CRC */
 
-            crc32    = IOEN_CRC32_INIT_VALUE;  /* Start value */
-            nofBytes = msginfo_p->crcOffset;
-
-            for (i=0; i<nofBytes; i++)
-            {
-                k     = ((crc32 BIT_RSHIFT 24) BIT_XOR (UInt32_t)(data_p[i])) BIT_AND 0xFF;
-                crc32 = (crc32 BIT_LSHIFT 8) BIT_XOR crc32LookupTable[k];
-            }
+            crc32 = ioen_crc32Engine (IOEN_CRC32_INIT_VALUE, data_p, msginfo_p->crcOffset);
 
             /* Finish XOR for 32 bit CRC */
             crc32 = crc32 BIT_XOR  IOEN_CRC32_FINISH_VALUE;
@@ -102,13 +234,13 @@ Bool_t ioen_UtilCheckCrc (
  *
  * DESCRIPTION:
  *   This function calculates an ARINC 32 bit CRC for the given data, and sets it in the output data
- *   A lookup table is used to improve performance.
+ *   The CRC engine selected by ioen_UtilInitCrc is used (see ioen_UtilCrcSlice8).
  *   The Polynomial used for (ARINC 653) is
  *      0x04C11DB7, => x32 + x26 + x23 + x22 + x16 + x12 + x11 + x10 + x8 + x7 + x5 + x4 + x2 + x + 1
  *
  * INTERFACE:
  *
- *   Global Data      :  crc32LookupTable
+ *   Global Data      :  ioen_crc32Engine
  *
  *   In Out:  data_p       : pointer to input array to calculate the CRC on
  *   In    :  msginfo_p    : Pointer to information where the CRC is stored
@@ -119,25 +251,14 @@ void ioen_UtilSetCrc (
    /* IN     */ const AfdxMessageInfo_t  * const msginfo_p
 )
 {
-    UInt32_t nofBytes;
     UInt32_t crc32;
-    UInt32_t i;
-    UInt32_t k;
-
 
     if (msginfo_p->crcOffset != 0)
     {
         /* Set the Functional status before calculating CRC */
         *((Byte_t*)(data_p + msginfo_p->crcFsbOffset)) = IOEN_A664_FS_NO;
 
-        crc32    = IOEN_CRC32_INIT_VALUE;  /* Start value */
-        nofBytes = msginfo_p->crcOffset;
-
-        for (i=0; i<nofBytes; i++)
-        {
-            k     = ((crc32 BIT_RSHIFT 24) BIT_XOR (UInt32_t)(data_p[i])) BIT_AND 0xFF;
-            crc32 = (crc32 BIT_LSHIFT 8) BIT_XOR crc32LookupTable[k];
-        }
+        crc32 = ioen_crc32Engine (IOEN_CRC32_INIT_VALUE, data_p, msginfo_p->crcOffset);
 
         /* Finish XOR for 32 bit CRC */
         crc32 = crc32 BIT_XOR  IOEN_CRC32_FINISH_VALUE;
@@ -334,3 +455,33 @@ Bool_t ioen_UtilIsZero (
     return isZero;
 }
 
+
+
+/******************************************************************
+ * FUNCTION NAME:
+ *   ioen_UtilPopCount
+ *
+ * DESCRIPTION:
+ *   This function returns the number of set bits of a word.
+ *   The bits are summed in parallel in 2, 4 and 8 bit fields, the compiler maps this to a
+ *   population count instruction where the target has one.
+ *
+ * INTERFACE:
+ *
+ *   In:  word : word to count
+ *
+ *   Return:  Number of set bits
+ *
+ ******************************************************************/
+UInt32_t ioen_UtilPopCount (
+   /* IN     */ const UInt32_t                   word
+)
+{
+    UInt32_t count;
+
+    count = word - ((word BIT_RSHIFT 1) BIT_AND 0x55555555U);
+    count = (count BIT_AND 0x33333333U) + ((count BIT_RSHIFT 2) BIT_AND 0x33333333U);
+    count = (count + (count BIT_RSHIFT 4)) BIT_AND 0x0F0F0F0FU;
+
+    return ((count * 0x01010101U) BIT_RSHIFT 24);
+}